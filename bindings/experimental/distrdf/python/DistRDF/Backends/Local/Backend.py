@@ -0,0 +1,153 @@
+################################################################################
+# Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+from __future__ import annotations
+
+import multiprocessing
+import os
+import threading
+import uuid
+import warnings
+from functools import partial
+from typing import Any, Callable, Dict, List, Optional, Tuple
+
+from DistRDF import DataFrame
+from DistRDF import HeadNode
+from DistRDF.Backends import Base
+
+# The ranges and the mapper of the executions currently being processed, keyed
+# by a unique identifier of the execution. They are registered right before the
+# worker processes are forked, so that the children inherit them from the
+# parent address space. Only the identifier and the index of the range are then
+# sent to the workers: this avoids having to pickle the mapper, which holds
+# closures that the standard pickle module cannot serialize. Using a registry
+# rather than a single global allows multiple graphs to be submitted
+# concurrently, e.g. via RunGraphs.
+_executions: Dict[uuid.UUID, Tuple[List[Any], Callable[..., Base.TaskResult]]] = {}
+
+# Serializes the forks of the worker processes and the merging of the partial
+# results in the parent process across threads. RunGraphs executes the graphs
+# from several Python threads: a fork while another thread holds an interpreter
+# or Python lock would leave that lock held forever in the child, which would
+# then deadlock e.g. on its first JIT compilation. Merging partial results goes
+# through ROOT, so it must not run while another thread forks.
+_fork_lock = threading.Lock()
+
+
+def local_mapper(execution_id: uuid.UUID, range_index: int) -> Base.TaskResult:
+    """
+    Runs the mapper on the range at the given index. Executed in a forked
+    worker process.
+
+    Headers and shared libraries do not need to be declared again: they were
+    declared in the parent process by the `distribute_*` methods of the backend
+    and are inherited by the forked child.
+    """
+    ranges, mapper = _executions[execution_id]
+    return mapper(ranges[range_index])
+
+
+class LocalBackend(Base.BaseBackend):
+    """
+    Backend that executes the computational graph on a pool of worker processes
+    forked from the current session, in the same spirit as
+    ROOT::TProcessExecutor. No external service is needed: this allows running
+    the same graph splitting as the distributed backends on a single node, for
+    example on batch nodes or to compare against implicit multithreading.
+    """
+
+    def __init__(self, nworkers: Optional[int] = None):
+        """
+        Creates an instance of the local backend class.
+
+        Args:
+            nworkers (int, optional): The number of worker processes. By
+                default this is the number of cores of the machine.
+        """
+        super(LocalBackend, self).__init__()
+
+        if "fork" not in multiprocessing.get_all_start_methods():
+            raise RuntimeError("The local distributed RDataFrame backend requires the 'fork' start method, "
+                               "which is not available on this platform.")
+
+        if nworkers is not None and nworkers < 1:
+            raise ValueError(f"The number of worker processes must be positive, got {nworkers}.")
+
+        self.nworkers = nworkers if nworkers is not None else os.cpu_count()
+
+    def optimize_npartitions(self) -> int:
+        """
+        One partition per worker process.
+        """
+        return self.nworkers
+
+    def ProcessAndMerge(self, ranges, mapper, reducer):
+        """
+        Performs map-reduce on a pool of forked worker processes. A new pool is
+        created for every execution, so that the workers see everything that
+        was declared to the interpreter in the current session up to this
+        point. Partial results are merged in the parent process as soon as
+        they arrive, so at most one partial result per worker is kept in
+        memory at any time. Forking the workers and merging the results are
+        serialized with the other executions running concurrently in other
+        threads.
+
+        Args:
+            ranges (list): A list of ranges to be processed.
+
+            mapper (function): A function that runs the computational graph
+                and returns a list of values.
+
+            reducer (function): A function that merges two lists that were
+                returned by the mapper.
+
+        Returns:
+            list: A list representing the values of action nodes returned
+            after computation (Map-Reduce).
+        """
+        execution_id = uuid.uuid4()
+        _executions[execution_id] = (ranges, mapper)
+
+        merged_results = None
+        try:
+            context = multiprocessing.get_context("fork")
+            with _fork_lock:
+                pool = context.Pool(processes=min(self.nworkers, len(ranges)))
+            with pool:
+                for result in pool.imap_unordered(partial(local_mapper, execution_id), range(len(ranges))):
+                    with _fork_lock:
+                        merged_results = reducer(merged_results, result) if merged_results is not None else result
+        finally:
+            del _executions[execution_id]
+
+        return merged_results
+
+    def ProcessAndMergeLive(self, ranges, mapper, reducer, drawables_info_dict):
+        """
+        Informs the user that the live visualization feature is not supported for the local backend
+        and refers to ProcessAndMerge to proceed with the standard map-reduce workflow.
+        """
+        warnings.warn("The live visualization feature is not supported for the local backend. Skipping LiveVisualize.")
+        return self.ProcessAndMerge(ranges, mapper, reducer)
+
+    def distribute_unique_paths(self, paths):
+        """
+        The worker processes share the filesystem and the address space of the
+        current session, nothing needs to be sent.
+        """
+        pass
+
+    def make_dataframe(self, *args, **kwargs):
+        """
+        Creates an instance of distributed RDataFrame that can send computations
+        to a pool of local worker processes.
+        """
+        # Set the number of partitions for this dataframe, one of the following:
+        # 1. User-supplied `npartitions` optional argument
+        npartitions = kwargs.pop("npartitions", None)
+        headnode = HeadNode.get_headnode(self, npartitions, *args)
+        return DataFrame.RDataFrame(headnode)
@@ -0,0 +1,78 @@
+import unittest
+
+import ROOT
+
+import DistRDF
+from DistRDF.Backends.Local import Backend
+
+
+class LocalBackendTest(unittest.TestCase):
+    """Tests of the local multi-process backend."""
+
+    def test_invalid_nworkers(self):
+        """A non-positive number of workers is rejected."""
+        with self.assertRaises(ValueError):
+            Backend.LocalBackend(nworkers=0)
+
+    def test_optimize_npartitions(self):
+        """By default there is one partition per worker process."""
+        backend = Backend.LocalBackend(nworkers=3)
+        self.assertEqual(backend.optimize_npartitions(), 3)
+
+    def test_emptysource(self):
+        """
+        Results do not depend on the number of partitions nor on the number
+        of worker processes.
+        """
+        nentries = 100
+        for nworkers in (1, 2):
+            for npartitions in (1, 2, 7):
+                with self.subTest(nworkers=nworkers, npartitions=npartitions):
+                    backend = Backend.LocalBackend(nworkers=nworkers)
+                    df = backend.make_dataframe(nentries, npartitions=npartitions).Define("x", "rdfentry_")
+                    count = df.Count()
+                    s = df.Sum("x")
+                    h = df.Histo1D(("h", "h", 10, 0, 100), "x")
+                    self.assertEqual(count.GetValue(), nentries)
+                    self.assertEqual(s.GetValue(), sum(range(nentries)))
+                    self.assertEqual(h.GetEntries(), nentries)
+
+    def test_ttree(self):
+        """Processing a dataset made of multiple files and clusters."""
+        backend = Backend.LocalBackend(nworkers=2)
+        df = backend.make_dataframe("myTree", ["4clusters.root", "2clusters.root"], npartitions=3)
+        localdf = ROOT.RDataFrame("myTree", ["4clusters.root", "2clusters.root"])
+        self.assertEqual(df.Count().GetValue(), localdf.Count().GetValue())
+
+
+    def test_rungraphs(self):
+        """
+        Several graphs submitted concurrently with RunGraphs, each with its own
+        JIT-compiled expressions, give the same results as sequential runs.
+        """
+        nentries = 1000
+        ngraphs = 4
+        backend = Backend.LocalBackend(nworkers=2)
+        counts = []
+        sums = []
+        histos = []
+        for i in range(ngraphs):
+            df = backend.make_dataframe(nentries, npartitions=3).Define("x", f"rdfentry_ % {i + 3}")
+            filtered = df.Filter(f"x > {i}")
+            counts.append(filtered.Count())
+            sums.append(filtered.Sum("x"))
+            histos.append(df.Histo1D((f"h{i}", f"h{i}", 10, 0, 10), "x"))
+
+        self.assertEqual(DistRDF.RunGraphs(counts + sums + histos), ngraphs)
+
+        for i in range(ngraphs):
+            with self.subTest(graph=i):
+                values = [entry % (i + 3) for entry in range(nentries)]
+                selected = [x for x in values if x > i]
+                self.assertEqual(counts[i].GetValue(), len(selected))
+                self.assertEqual(sums[i].GetValue(), sum(selected))
+                self.assertEqual(histos[i].GetEntries(), nentries)
+
+
+if __name__ == "__main__":
+    unittest.main(argv=[__file__])
@@ -29,7 +29,9 @@ class RooVectorDataStore(object):
         for x in array_info.cats:
             check_for_duplicate_name(x.name)
             data[x.name] = np.frombuffer(x.data, dtype=np.int32, count=n)
-        if copy:
+        # The columns stored in single precision are converted into buffers
+        # owned by array_info, so they have to be copied.
+        if copy or len(array_info.buffers) > 0:
             for name in data.keys():
                 data[name] = np.copy(data[name])
 
@@ -118,13 +118,15 @@ namespace ROOT {
       template<class T>
       using MergeFunctionType = std::function<void(std::shared_ptr<T>, std::vector<std::shared_ptr<T>>&)>;
 
-      /// Merge TObjects
+      /// Merge TObjects.
+      /// All objects are passed to a single call of the Merge method of the target, so that it can process them
+      /// together: for instance TH1::Merge merges ranges of bins of all the histograms in parallel when implicit
+      /// multi-threading is enabled.
       template<class T>
       void MergeTObjects(std::shared_ptr<T> target, std::vector<std::shared_ptr<T>> &objs)
       {
          if (!target) return;
          TList objTList;
-         // Cannot do better than this
          for (auto obj : objs) {
             if (obj && obj != target) objTList.Add(obj.get());
          }
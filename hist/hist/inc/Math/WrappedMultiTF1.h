@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 namespace ROOT {
 
@@ -160,6 +161,17 @@ namespace ROOT {
             return fFunc->EvalPar(x, p);
          }
 
+         /// evaluate function at many points using TF1::EvalBatch
+         void DoEvalParBatch(unsigned int n, const T *x, const double *p, T *result) const override
+         {
+            if constexpr (std::is_same<T, double>::value) {
+               fFunc->EvalBatch(std::span<const double>(x, n * fDim), std::span<double>(result, n), p);
+            } else {
+               for (unsigned int i = 0; i < n; ++i)
+                  result[i] = fFunc->EvalPar(x + i * fDim, p);
+            }
+         }
+
          /// evaluate function using the cached parameter values (of TF1)
          /// re-implement for better efficiency
          T DoEvalVec(const T *x) const
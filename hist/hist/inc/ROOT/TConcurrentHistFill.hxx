@@ -0,0 +1,216 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TConcurrentHistFill
+#define ROOT_TConcurrentHistFill
+
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "THnBase.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "TProfile3D.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ROOT {
+
+template <class HIST>
+class TConcurrentHistFiller;
+
+/**
+\class ROOT::TConcurrentHistFillManager
+\ingroup Hist
+\brief Allow several threads to fill the same TH1, TH2, TH3 or THn.
+
+With TThreadedObject each thread fills its own copy of the histogram, and the copies are merged at the end. For
+large histograms this multiplies the memory by the number of threads and makes the final merge expensive.
+TConcurrentHistFillManager instead hands out TConcurrentHistFiller objects, one per thread, that buffer their Fill
+calls and periodically flush them to the single shared histogram while holding a lock. Contention is low because a
+lock is only taken once per buffer, and the memory overhead is bounded by the size of the buffers.
+
+~~~{.cpp}
+TH3D h("h", "h", 500, 0, 1, 500, 0, 1, 500, 0, 1);
+ROOT::TConcurrentHistFillManager<TH3D> manager(h);
+auto work = [&] {
+   auto filler = manager.MakeFiller();
+   for (int i = 0; i < 1000000; ++i)
+      filler.Fill(gRandom->Rndm(), gRandom->Rndm(), gRandom->Rndm());
+   // the remaining entries are flushed when the filler goes out of scope
+};
+std::vector<std::thread> threads;
+for (int i = 0; i < 4; ++i)
+   threads.emplace_back(work);
+for (auto &t : threads)
+   t.join();
+~~~
+
+With RDataFrame, one filler per processing slot can be used in ForeachSlot, and the fillers must be destroyed (or
+flushed) before the histogram is read.
+
+Profiles are not supported, since their Fill calls have a different meaning.
+*/
+template <class HIST>
+class TConcurrentHistFillManager {
+   friend class TConcurrentHistFiller<HIST>;
+
+   static_assert(std::is_base_of<TH1, HIST>::value || std::is_base_of<THnBase, HIST>::value,
+                 "TConcurrentHistFillManager only supports histograms deriving from TH1 or THnBase.");
+
+   HIST &fHist;
+   std::mutex fFillMutex;
+   unsigned int fBufferSize;
+
+   /// Fill the histogram with n entries stored in buffer as (x_0, ..., x_ndim-1, weight).
+   void FillBuffer(const std::vector<Double_t> &buffer, int nDim)
+   {
+      const Int_t stride = nDim + 1;
+      const Int_t n = buffer.size() / stride;
+      if (n == 0)
+         return;
+      const Double_t *b = buffer.data();
+
+      std::lock_guard<std::mutex> lock(fFillMutex);
+      if constexpr (std::is_base_of<THnBase, HIST>::value) {
+         for (Int_t i = 0; i < n; ++i)
+            fHist.Fill(b + i * stride, b[i * stride + nDim]);
+      } else {
+         if (nDim == 1) {
+            static_cast<TH1 &>(fHist).FillN(n, b, b + 1, stride);
+         } else if (nDim == 2) {
+            static_cast<TH2 &>(static_cast<TH1 &>(fHist)).FillN(n, b, b + 1, b + 2, stride);
+         } else {
+            auto &h3 = static_cast<TH3 &>(static_cast<TH1 &>(fHist));
+            for (Int_t i = 0; i < n * stride; i += stride)
+               h3.Fill(b[i], b[i + 1], b[i + 2], b[i + 3]);
+         }
+      }
+   }
+
+public:
+   /// Construct a manager that fills hist. Each filler buffers up to bufferSize entries before flushing them.
+   TConcurrentHistFillManager(HIST &hist, unsigned int bufferSize = 1024) : fHist(hist), fBufferSize(bufferSize)
+   {
+      if (fBufferSize == 0)
+         throw std::invalid_argument("TConcurrentHistFillManager: the buffer size must be positive.");
+      if constexpr (std::is_base_of<TH1, HIST>::value) {
+         const TH1 *h = &hist;
+         if (dynamic_cast<const TProfile *>(h) || dynamic_cast<const TProfile2D *>(h) ||
+             dynamic_cast<const TProfile3D *>(h))
+            throw std::invalid_argument(std::string("TConcurrentHistFillManager: ") + h->GetName() +
+                                        " is a profile, which is not supported.");
+      }
+   }
+
+   TConcurrentHistFillManager(const TConcurrentHistFillManager &) = delete;
+   TConcurrentHistFillManager &operator=(const TConcurrentHistFillManager &) = delete;
+
+   /// Return a filler for the calling thread. Fillers must not be shared among threads.
+   TConcurrentHistFiller<HIST> MakeFiller() { return TConcurrentHistFiller<HIST>(*this); }
+
+   HIST &GetHist() { return fHist; }
+};
+
+/**
+\class ROOT::TConcurrentHistFiller
+\ingroup Hist
+\brief Buffer the Fill calls of one thread and flush them to the histogram of a TConcurrentHistFillManager.
+
+The buffered entries are flushed when the buffer is full, when Flush() is called and when the filler is destroyed.
+*/
+template <class HIST>
+class TConcurrentHistFiller {
+   friend class TConcurrentHistFillManager<HIST>;
+
+   TConcurrentHistFillManager<HIST> *fManager;
+   /// Entries stored as (x_0, ..., x_ndim-1, weight)
+   std::vector<Double_t> fBuffer;
+   int fNDim;
+   std::size_t fMaxBufferSize;
+
+   static int GetNDim(const HIST &hist)
+   {
+      if constexpr (std::is_base_of<THnBase, HIST>::value)
+         return hist.GetNdimensions();
+      else
+         return hist.GetDimension();
+   }
+
+   TConcurrentHistFiller(TConcurrentHistFillManager<HIST> &manager)
+      : fManager(&manager), fNDim(GetNDim(manager.fHist)), fMaxBufferSize(manager.fBufferSize * (fNDim + 1))
+   {
+      fBuffer.reserve(fMaxBufferSize);
+   }
+
+   void Push(const Double_t *x, Double_t w)
+   {
+      fBuffer.insert(fBuffer.end(), x, x + fNDim);
+      fBuffer.push_back(w);
+      if (fBuffer.size() >= fMaxBufferSize)
+         Flush();
+   }
+
+public:
+   TConcurrentHistFiller(TConcurrentHistFiller &&other)
+      : fManager(other.fManager),
+        fBuffer(std::move(other.fBuffer)),
+        fNDim(other.fNDim),
+        fMaxBufferSize(other.fMaxBufferSize)
+   {
+      other.fManager = nullptr;
+   }
+   TConcurrentHistFiller(const TConcurrentHistFiller &) = delete;
+   TConcurrentHistFiller &operator=(const TConcurrentHistFiller &) = delete;
+   TConcurrentHistFiller &operator=(TConcurrentHistFiller &&) = delete;
+
+   ~TConcurrentHistFiller()
+   {
+      if (fManager)
+         Flush();
+   }
+
+   /// Fill the point x, which has one coordinate per histogram dimension, with weight w.
+   /// This is a template, so that a literal 0 is not converted to a null pointer: Fill(0) fills the value 0.
+   template <typename T, typename = std::enable_if_t<std::is_same<T, Double_t>::value>>
+   void Fill(const T *x, Double_t w = 1.)
+   {
+      Push(x, w);
+   }
+
+   /// Fill with the same arguments as the Fill method of the histogram: one value per dimension, optionally
+   /// followed by a weight. For example Fill(x, y) fills a TH2 with weight 1, and a TH1 with weight y.
+   template <typename... Values>
+   void Fill(Double_t first, Values... others)
+   {
+      const Double_t values[] = {first, static_cast<Double_t>(others)...};
+      constexpr int nValues = 1 + sizeof...(Values);
+      if (nValues == fNDim)
+         Push(values, 1.);
+      else if (nValues == fNDim + 1)
+         Push(values, values[nValues - 1]);
+      else
+         throw std::invalid_argument("TConcurrentHistFiller::Fill: wrong number of arguments for " +
+                                     std::to_string(fNDim) + " histogram dimensions.");
+   }
+
+   /// Fill the histogram with the buffered entries.
+   void Flush()
+   {
+      fManager->FillBuffer(fBuffer, fNDim);
+      fBuffer.clear();
+   }
+};
+
+} // namespace ROOT
+
+#endif
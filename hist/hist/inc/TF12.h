@@ -38,6 +38,7 @@ public:
    TF1     *DrawCopy(Option_t *option="") const override;
    Double_t Eval(Double_t x, Double_t y=0, Double_t z=0, Double_t t=0) const override;
    Double_t EvalPar(const Double_t *x, const Double_t *params=nullptr) override;
+   void     EvalBatch(std::span<const Double_t> x, std::span<Double_t> result, const Double_t *params=nullptr) override;
 
 #ifdef R__HAS_VECCORE
    using TF1::Eval;    // to not hide the vectorized version
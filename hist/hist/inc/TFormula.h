@@ -17,6 +17,7 @@
 #include "TInterpreter.h"
 #include "TMath.h"
 #include <Math/Types.h>
+#include <ROOT/RSpan.hxx>
 
 #include <atomic>
 #include <cassert>
@@ -107,6 +108,8 @@ private:
    CallFuncSignature fFuncPtr = nullptr;           ///<! Function pointer, owned by the JIT.
    CallFuncSignature fGradFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
    CallFuncSignature fHessFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
+   CallFuncSignature fBatchFuncPtr = nullptr;      ///<! Function pointer to the batched evaluation, owned by the JIT.
+   Bool_t            fBatchGenerationFailed = false; ///<! Flag to avoid generating again a failed batched evaluation
    void *   fLambdaPtr = nullptr;                  ///<! Pointer to the lambda function
    static bool       fIsCladRuntimeIncluded;
 
@@ -137,6 +140,10 @@ private:
    bool HasHessianGenerationFailed() const {
       return !fHessFuncPtr && !fHessGenerationInput.empty();
    }
+   std::string GetBatchFuncName() const {
+      return std::string(GetUniqueFuncName().Data()) + "_batch";
+   }
+   bool GenerateBatchFunction();
 
 protected:
 
@@ -200,6 +207,7 @@ public:
    template <typename... Args>
    Double_t       Eval(Args... args) const;
    Double_t       EvalPar(const Double_t *x, const Double_t *params = nullptr) const;
+   void           EvalBatch(std::span<const Double_t> x, std::span<Double_t> result, const Double_t *params = nullptr) const;
 
    /// Generate gradient computation routine with respect to the parameters.
    /// \returns true if a gradient was generated and GradientPar can be called.
@@ -103,6 +103,9 @@ protected:
                        const TObjArray* axes, Bool_t keepTargetAxis) const;
    virtual void Reserve(Long64_t /*nbins*/) {}
    virtual void SetFilledBins(Long64_t /*nbins*/) {};
+   /// Add the bins of h scaled by c, if the storage of h allows a faster way than iterating over its bins.
+   /// Return whether the bins were added; the statistics are not updated.
+   virtual Bool_t AddCompatibleBins(const THnBase* /*h*/, Double_t /*c*/) { return kFALSE; }
 
    Bool_t CheckConsistency(const THnBase *h, const char *tag) const;
    TH1* CreateHist(const char* name, const char* title,
@@ -180,6 +183,8 @@ protected:
       return -1;
    }
 
+   virtual void FillN(Long64_t n, const Double_t *x, const Double_t *w = nullptr);
+
    virtual void FillBin(Long64_t bin, Double_t w) = 0;
 
    void SetBinEdges(Int_t idim, const Double_t* bins);
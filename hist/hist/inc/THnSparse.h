@@ -21,7 +21,6 @@
 
 
 #include "THnBase.h"
-#include "TExMap.h"
 #include "THnSparse_Internal.h"
 
 // needed only for template instantiations of THnSparseT:
@@ -32,14 +31,14 @@
 #include "TArrayC.h"
 
 class THnSparseCompactBinCoord;
+class THnSparseBinIndex;
 
 class THnSparse: public THnBase {
  private:
    Int_t      fChunkSize;                   ///<  Number of entries for each chunk
    Long64_t   fFilledBins;                  ///<  Number of filled bins
    TObjArray  fBinContent;                  ///<  Array of THnSparseArrayChunk
-   TExMap     fBins;                        ///<! Filled bins
-   TExMap     fBinsContinued;               ///<! Filled bins for non-unique hashes, containing pairs of (bin index 0, bin index 1)
+   THnSparseBinIndex *fBinIndex;            ///<! Hash table from the compact coordinates to the filled bins
    THnSparseCompactBinCoord *fCompactCoord; ///<! Compact coordinate
 
    THnSparse(const THnSparse&) = delete;
@@ -57,9 +56,11 @@ class THnSparse: public THnBase {
 
    THnSparseArrayChunk* AddChunk();
    void Reserve(Long64_t nbins) override;
-   void FillExMap();
+   void FillBinIndex();
    virtual TArray* GenerateArray() const = 0;
    Long64_t GetBinIndexForCurrentBin(Bool_t allocate);
+   Long64_t GetBinIndexForBuffer(const Char_t* buf, ULong64_t hash, Bool_t allocate);
+   Bool_t AddCompatibleBins(const THnBase* h, Double_t c) override;
 
    /// Increment the bin content of "bin" by "w",
    /// return the bin index.
@@ -99,6 +100,8 @@ class THnSparse: public THnBase {
    Long64_t GetBin(const Double_t* x, Bool_t allocate = kTRUE) override;
    Long64_t GetBin(const char* name[], Bool_t allocate = kTRUE) override;
 
+   void FillN(Long64_t n, const Double_t* x, const Double_t* w = nullptr) override;
+
    /// Forwards to THnBase::SetBinContent().
    /// Non-virtual, CINT-compatible replacement of a using declaration.
    void SetBinContent(const Int_t* idx, Double_t v) {
@@ -76,6 +76,13 @@ public:
       kForcedBinning
    };
 
+   /// Evaluation of the density estimate.
+   /// It can be set using SetEvaluation()
+   enum EEvaluation {
+      kExactEvaluation, ///< Sum the kernels of all the data points (or bins) at each evaluation
+      kGridEvaluation   ///< Interpolate the density computed once on a grid, with linear binning and FFT convolutions
+   };
+
    ///  default constructor used only by I/O
    TKDE();
 
@@ -123,6 +130,7 @@ public:
    void SetUseBinsNEvents(UInt_t nEvents);
    void SetTuneFactor(Double_t rho);
    void SetRange(Double_t xMin, Double_t xMax); ///< By default computed from the data
+   void SetEvaluation(EEvaluation eval, Double_t tolerance = 1.E-4);
 
    void Draw(const Option_t* option = "") override;
 
@@ -164,9 +172,13 @@ public:
       TKDE *fKDE;
       UInt_t fNWeights;               ///< Number of kernel weights (bandwidth as vectorized for binning)
       std::vector<Double_t> fWeights; ///< Kernel weights (bandwidth)
+      Double_t fGridMin = 0.;         ///< Position of the first grid point
+      Double_t fGridDelta = 0.;       ///< Distance between two grid points
+      std::vector<Double_t> fGrid;    ///< Density estimate at the grid points, used for kGridEvaluation
    public:
       TKernel(Double_t weight, TKDE *kde);
       void ComputeAdaptiveWeights();
+      void ComputeGrid();
       Double_t operator()(Double_t x) const;
       Double_t GetWeight(Double_t x) const;
       Double_t GetFixedWeight() const;
@@ -200,6 +212,7 @@ private:
    EIteration fIteration;
    EMirror fMirror;
    EBinning fBinning;
+   EEvaluation fEvaluation;
 
 
    Bool_t fUseMirroring, fMirrorLeft, fMirrorRight, fAsymLeft, fAsymRight;
@@ -221,6 +234,7 @@ private:
    Double_t fAdaptiveBandwidthFactor;  ///< Geometric mean of the kernel density estimation from the data for adaptive iteration
 
    Double_t fWeightSize;               ///< Caches the weight size
+   Double_t fTolerance;                ///< Relative accuracy of the grid evaluation
 
    std::vector<Double_t> fCanonicalBandwidths;
    std::vector<Double_t> fKernelSigmas2;
@@ -261,6 +275,7 @@ private:
    Double_t ComputeKernelSigma2() const;
    Double_t ComputeKernelMu() const;
    Double_t ComputeKernelIntegral() const;
+   Double_t ComputeKernelSupport() const;
    Double_t ComputeMidspread() ;
    void ComputeDataStats() ;
 
@@ -298,7 +313,7 @@ private:
    TF1* GetPDFUpperConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
    TF1* GetPDFLowerConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
 
-   ClassDefOverride(TKDE, 3) // One dimensional semi-parametric Kernel Density Estimation
+   ClassDefOverride(TKDE, 4) // One dimensional semi-parametric Kernel Density Estimation
 
 };
 
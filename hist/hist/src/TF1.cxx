@@ -1530,6 +1530,44 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function at many points with given parameters.
+///
+/// The points are stored one after the other in x, which must contain result.size()
+/// times the same number of coordinates, and the function values are stored in result.
+/// If params is null the internal values of the parameters are used.
+/// Functions defined by a formula are evaluated with TFormula::EvalBatch, which avoids
+/// the cost of calling the compiled expression once per point. The other functions are
+/// evaluated point by point with EvalPar.
+
+void TF1::EvalBatch(std::span<const Double_t> x, std::span<Double_t> result, const Double_t *params)
+{
+   const std::size_t n = result.size();
+   if (n == 0)
+      return;
+   if (fType == EFType::kFormula) {
+      assert(fFormula);
+      fFormula->EvalBatch(x, result, params);
+      if (fNormalized && fNormIntegral != 0)
+         for (auto &value : result)
+            value /= fNormIntegral;
+      return;
+   }
+
+   const std::size_t stride = x.size() / n;
+   if (stride * n != x.size()) {
+      Error("EvalBatch", "%zu coordinates are not %zu points of the same dimension", x.size(), n);
+      return;
+   }
+   // copy each point to a buffer at a fixed address, as needed by interpreted functions
+   std::vector<Double_t> xx(std::max<std::size_t>(stride, 1));
+   InitArgs(xx.data(), params);
+   for (std::size_t i = 0; i < n; ++i) {
+      std::copy(x.begin() + i * stride, x.begin() + (i + 1) * stride, xx.begin());
+      result[i] = EvalPar(xx.data(), params);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -3048,7 +3086,6 @@ void TF1::Paint(Option_t *option)
 TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
 {
    Int_t i;
-   Double_t xv[1];
 
    TH1 *histogram = nullptr;
 
@@ -3118,11 +3155,13 @@ TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
    histogram->GetYaxis()->SetTitle(ytitle.Data());
    Double_t *parameters = GetParameters();
 
-   InitArgs(xv, parameters);
-   for (i = 1; i <= fNpx; i++) {
-      xv[0] = histogram->GetBinCenter(i);
-      histogram->SetBinContent(i, EvalPar(xv, parameters));
-   }
+   std::vector<Double_t> binCenters(fNpx);
+   std::vector<Double_t> values(fNpx);
+   for (i = 1; i <= fNpx; i++)
+      binCenters[i - 1] = histogram->GetBinCenter(i);
+   EvalBatch(binCenters, values, parameters);
+   for (i = 1; i <= fNpx; i++)
+      histogram->SetBinContent(i, values[i - 1]);
 
    // Copy Function attributes to histogram attributes.
    histogram->SetBit(TH1::kNoStats);
@@ -170,6 +170,27 @@ Double_t TF12::EvalPar(const Double_t *x, const Double_t *params)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate this function at many points, see TF1::EvalBatch.
+///
+/// The 2-D function is evaluated at once at the points (x[i], fXY) if fCase = 0,
+/// or (fXY, x[i]) if fCase = 1.
+
+void TF12::EvalBatch(std::span<const Double_t> x, std::span<Double_t> result, const Double_t *params)
+{
+   const std::size_t n = result.size();
+   if (!fF2) {
+      std::fill(result.begin(), result.end(), 0.);
+      return;
+   }
+   std::vector<Double_t> xx(2 * n, fXY);
+   const std::size_t coord = (fCase == 0) ? 0 : 1;
+   for (std::size_t i = 0; i < n && i < x.size(); ++i)
+      xx[2 * i + coord] = x[i];
+   fF2->EvalBatch(xx, result, params);
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Save primitive as a C++ statement(s) on output stream out
 
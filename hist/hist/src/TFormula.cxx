@@ -757,6 +757,8 @@ void TFormula::Copy(TObject &obj) const
    fnew.fHessGenerationInput = fHessGenerationInput;
    fnew.fGradFuncPtr = fGradFuncPtr;
    fnew.fHessFuncPtr = fHessFuncPtr;
+   fnew.fBatchFuncPtr = fBatchFuncPtr;
+   fnew.fBatchGenerationFailed = fBatchGenerationFailed;
 
 }
 
@@ -773,6 +775,8 @@ void TFormula::Clear(Option_t * )
    fClingName = "";
 
    fMethod.reset();
+   fBatchFuncPtr = nullptr;
+   fBatchGenerationFailed = false;
 
    fClingVariables.clear();
    fClingParameters.clear();
@@ -2334,6 +2338,9 @@ void TFormula::ProcessFormula(TString &formula)
          // set the cling name using hash of the static formulae map
          auto hasher = gClingFunctions.hash_function();
          fClingName = TString::Format("%s__id%zu", gNamePrefix.Data(), hasher(inputFormulaVecFlag));
+         // the batched evaluation is generated again if needed for the new expression
+         fBatchFuncPtr = nullptr;
+         fBatchGenerationFailed = false;
 
          fClingInput = TString::Format("%s %s(%s){ return %s ; }", argType.Data(), fClingName.Data(),
                                        argumentsPrototype.Data(), inputFormula.c_str());
@@ -3314,6 +3321,110 @@ void TFormula::HessianPar(const Double_t *x, Double_t *result) {
    CallCladFunction(fHessFuncPtr, vars, pars, result, fNpar * fNpar);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generate with Cling the function used by EvalBatch, which loops on the points
+/// with the formula expression inlined in the loop body:
+/// ~~~ {.cpp}
+/// void TFormula____id123_batch(Long64_t n, Long64_t stride, Double_t *xs, Double_t *p, Double_t *out) {
+///    for (Long64_t i = 0; i < n; ++i) {
+///       Double_t *x = xs + i * stride;
+///       out[i] = <formula expression>;
+///    }
+/// }
+/// ~~~
+/// Returns true on success.
+
+bool TFormula::GenerateBatchFunction()
+{
+   if (fBatchFuncPtr)
+      return true;
+   if (fBatchGenerationFailed || !fClingInitialized || fVectorized || TestBit(TFormula::kLambda))
+      return false;
+
+   fBatchGenerationFailed = true;
+   // as for the gradient, the function can have been generated already by another TFormula with the same expression
+   const std::string funcName = GetBatchFuncName();
+   if (!functionExists(funcName)) {
+      TString expression = GetExpFormula("CLING");
+      std::string code = "#pragma cling optimize(2)\nvoid " + funcName +
+                         "(Long64_t n, Long64_t stride, Double_t *xs, Double_t *p, Double_t *out) {\n"
+                         "   for (Long64_t i = 0; i < n; ++i) {\n"
+                         "      Double_t *x = xs + i * stride;\n"
+                         "      out[i] = " + std::string(expression.Data()) + ";\n"
+                         "   }\n"
+                         "}";
+      if (!gInterpreter->Declare(code.c_str()))
+         return false;
+   }
+   TMethodCall method;
+   method.InitWithPrototype(funcName.c_str(), "Long64_t,Long64_t,Double_t*,Double_t*,Double_t*");
+   if (!method.IsValid())
+      return false;
+   fBatchFuncPtr = prepareFuncPtr(&method);
+   fBatchGenerationFailed = !fBatchFuncPtr;
+   return fBatchFuncPtr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula at many points.
+/// The points are stored one after the other in x, which must contain result.size() times the same number of
+/// coordinates (at least GetNdim()), and their values are stored in result. If params is null the parameters of
+/// the formula are used.
+///
+/// The first call generates a function that loops on the points with the formula expression inlined, so that
+/// the per-point cost of calling the formula through the interpreter interface disappears and the compiler can
+/// optimize (and vectorize when possible) the loop. Vectorized formulas are evaluated on packs of ROOT::Double_v,
+/// and lambda expressions point by point.
+
+void TFormula::EvalBatch(std::span<const Double_t> x, std::span<Double_t> result, const Double_t *params) const
+{
+   const std::size_t n = result.size();
+   if (n == 0)
+      return;
+   const std::size_t stride = x.size() / n;
+   if (stride * n != x.size() || stride < std::size_t(fNdim)) {
+      Error("EvalBatch", "%zu coordinates are not %zu points of dimension %d", x.size(), n, fNdim);
+      return;
+   }
+   // x is null for a formula without variables
+   auto point = [&](std::size_t i) { return stride > 0 ? x.data() + i * stride : nullptr; };
+
+#ifdef R__HAS_VECCORE
+   if (fVectorized) {
+      const std::size_t vecSize = vecCore::VectorSize<ROOT::Double_v>();
+      std::vector<ROOT::Double_v> xvec(fNdim, ROOT::Double_v(0.));
+      for (std::size_t i = 0; i < n; i += vecSize) {
+         const std::size_t m = std::min(vecSize, n - i);
+         for (int j = 0; j < fNdim; ++j)
+            for (std::size_t k = 0; k < m; ++k)
+               vecCore::Set(xvec[j], k, point(i + k)[j]);
+         ROOT::Double_v ans = DoEvalVec(fNdim > 0 ? xvec.data() : nullptr, params);
+         for (std::size_t k = 0; k < m; ++k)
+            result[i + k] = vecCore::Get(ans, k);
+      }
+      return;
+   }
+#endif
+
+   if (!fBatchFuncPtr && !fBatchGenerationFailed && fClingInitialized && !TestBit(TFormula::kLambda)) {
+      R__LOCKGUARD(gROOTMutex);
+      const_cast<TFormula *>(this)->GenerateBatchFunction();
+   }
+   if (!fBatchFuncPtr) {
+      for (std::size_t i = 0; i < n; ++i)
+         result[i] = DoEval(point(i), params);
+      return;
+   }
+
+   Long64_t nPoints = n;
+   Long64_t xStride = stride;
+   Double_t *vars = const_cast<Double_t *>(x.data());
+   Double_t *pars = (params) ? const_cast<Double_t *>(params) : const_cast<Double_t *>(fClingParameters.data());
+   Double_t *out = result.data();
+   void *args[5] = {&nPoints, &xStride, &vars, &pars, &out};
+   (*fBatchFuncPtr)(nullptr, 5, args, /*ret*/ nullptr);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 #ifdef R__HAS_VECCORE
 // ROOT::Double_v TFormula::Eval(ROOT::Double_v x, ROOT::Double_v y, ROOT::Double_v z, ROOT::Double_v t) const
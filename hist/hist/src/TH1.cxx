@@ -3474,28 +3474,43 @@ void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride
 
 void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
 {
-   Int_t bin,i;
-
    fEntries += ntimes;
-   Double_t ww = 1;
-   Int_t nbins   = fXaxis.GetNbins();
-   ntimes *= stride;
-   for (i=0;i<ntimes;i+=stride) {
-      bin =fXaxis.FindBin(x[i]);
-      if (bin <0) continue;
-      if (w) ww = w[i];
+   const Int_t nbins = fXaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+
+   auto fillBin = [&](Int_t bin, Int_t i) {
+      if (bin <0) return;
+      const Double_t ww = w ? w[i] : 1.;
       if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
       if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
       AddBinContent(bin, ww);
       if (bin == 0 || bin > nbins) {
-         if (!GetStatOverflowsBehaviour()) continue;
+         if (!statOverflows) return;
       }
       Double_t z= ww;
       fTsumw   += z;
       fTsumw2  += z*z;
       fTsumwx  += z*x[i];
       fTsumwx2 += z*x[i]*x[i];
+   };
+
+   // FindBin only differs from FindFixBin if the axis can be extended. Otherwise, compute the bins of a whole
+   // chunk of values at once, which is much faster than calling FindBin for each value.
+   if (!fXaxis.CanExtend() || fXaxis.IsAlphanumeric()) {
+      constexpr Int_t kChunkSize = 256;
+      Int_t bins[kChunkSize];
+      for (Int_t first = 0; first < ntimes; first += kChunkSize) {
+         const Int_t n = std::min(kChunkSize, ntimes - first);
+         fXaxis.FindFixBins(n, &x[first * stride], bins, stride);
+         for (Int_t j = 0; j < n; ++j)
+            fillBin(bins[j], (first + j) * stride);
+      }
+      return;
    }
+
+   ntimes *= stride;
+   for (Int_t i = 0; i < ntimes; i += stride)
+      fillBin(fXaxis.FindBin(x[i]), i);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
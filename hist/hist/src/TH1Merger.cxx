@@ -1,5 +1,6 @@
 // Helper clas implementing some of the TH1 functionality
 
+#include "RConfigure.h" // R__USE_IMT
 #include "TH1Merger.h"
 #include "TH1.h"
 #include "TH2.h"
@@ -8,9 +9,15 @@
 #include "TError.h"
 #include "THashList.h"
 #include "TClass.h"
+#include "TROOT.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #define PRINTRANGE(a, b, bn)                                                                                          \
    Printf(" base: %f %f %d, %s: %f %f %d", a->GetXmin(), a->GetXmax(), a->GetNbins(), bn, b->GetXmin(), b->GetXmax(), \
@@ -762,6 +769,7 @@ Bool_t TH1Merger::SameAxesMerge() {
    fH0->GetStats(totstats);
    Double_t nentries = fH0->GetEntries();
 
+   std::vector<const TH1 *> hists;
    TIter next(&fInputList);
    while (TH1* hist=(TH1*)next()) {
       // process only if the histogram has limits; otherwise it was processed before
@@ -778,13 +786,36 @@ Bool_t TH1Merger::SameAxesMerge() {
       for (Int_t i=0; i<TH1::kNstat; i++)
          totstats[i] += stats[i];
       nentries += hist->GetEntries();
+      hists.push_back(hist);
+   }
 
-         //Int_t nx = hist->GetXaxis()->GetNbins();
-         // loop on bins of the histogram and do the merge
-      for (Int_t ibin = 0; ibin < hist->fNcells; ibin++) {
-         MergeBin(hist, ibin, ibin);
+   // loop on the bins in [firstBin, lastBin) of the histograms and do the merge
+   auto mergeBins = [&](Int_t firstBin, Int_t lastBin) {
+      for (const TH1 *hist : hists) {
+         for (Int_t ibin = firstBin; ibin < lastBin; ibin++) {
+            MergeBin(hist, ibin, ibin);
+         }
       }
-   }
+   };
+   const Int_t ncells = fH0->fNcells;
+#ifdef R__USE_IMT
+   // For large merges, each task merges a range of bins of all histograms: every bin of fH0 is written by
+   // a single task, and it adds the histograms in the same order as the sequential merge, so the result is
+   // identical.
+   constexpr Int_t kMinBinsPerTask = 1 << 14;
+   constexpr Long64_t kMinBinsToMergeInParallel = 1 << 20;
+   const Int_t nTasks = std::min<Int_t>(ncells / kMinBinsPerTask, 4 * ROOT::GetThreadPoolSize());
+   if (ROOT::IsImplicitMTEnabled() && nTasks > 1 && Long64_t(ncells) * hists.size() >= kMinBinsToMergeInParallel) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](UInt_t task) {
+            mergeBins(Long64_t(ncells) * task / nTasks, Long64_t(ncells) * (task + 1) / nTasks);
+         },
+         ROOT::TSeqU(nTasks));
+   } else
+#endif
+      mergeBins(0, ncells);
+
    //copy merged stats
    fH0->PutStats(totstats);
    fH0->SetEntries(nentries);
@@ -645,7 +645,7 @@ Int_t TH2::Fill(Double_t x, const char *namey, Double_t w)
 
 void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
 {
-   Int_t binx, biny, bin, i;
+   Int_t i;
    ntimes *= stride;
    Int_t ifirst = 0;
 
@@ -664,22 +664,21 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
          return;
    }
 
-   Double_t ww = 1;
-   for (i=ifirst;i<ntimes;i+=stride) {
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+
+   auto fillBin = [&](Int_t binx, Int_t biny, Int_t i) {
       fEntries++;
-      binx = fXaxis.FindBin(x[i]);
-      biny = fYaxis.FindBin(y[i]);
-      if (binx <0 || biny <0) continue;
-      bin  = biny*(fXaxis.GetNbins()+2) + binx;
-      if (w) ww = w[i];
+      if (binx <0 || biny <0) return;
+      const Int_t bin  = biny*(fXaxis.GetNbins()+2) + binx;
+      const Double_t ww = w ? w[i] : 1.;
       if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
       if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
       AddBinContent(bin,ww);
       if (binx == 0 || binx > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+         if (!statOverflows) return;
       }
       if (biny == 0 || biny > fYaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+         if (!statOverflows) return;
       }
       Double_t z= ww; //(ww > 0 ? ww : -ww);
       fTsumw   += z;
@@ -689,7 +688,27 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
       fTsumwy  += z*y[i];
       fTsumwy2 += z*y[i]*y[i];
       fTsumwxy += z*x[i]*y[i];
+   };
+
+   // if no axis can be extended FindBin is equivalent to FindFixBin, and the bins of a whole chunk of values
+   // can be computed at once (see TH1::DoFillN)
+   const bool canExtend = (fXaxis.CanExtend() && !fXaxis.IsAlphanumeric()) || (fYaxis.CanExtend() && !fYaxis.IsAlphanumeric());
+   if (!canExtend) {
+      constexpr Int_t kChunkSize = 256;
+      Int_t binsx[kChunkSize];
+      Int_t binsy[kChunkSize];
+      for (Int_t first = ifirst; first < ntimes; first += kChunkSize * stride) {
+         const Int_t n = std::min(kChunkSize, (ntimes - first + stride - 1) / stride);
+         fXaxis.FindFixBins(n, &x[first], binsx, stride);
+         fYaxis.FindFixBins(n, &y[first], binsy, stride);
+         for (Int_t j = 0; j < n; ++j)
+            fillBin(binsx[j], binsy[j], first + j * stride);
+      }
+      return;
    }
+
+   for (i=ifirst;i<ntimes;i+=stride)
+      fillBin(fXaxis.FindBin(x[i]), fYaxis.FindBin(y[i]), i);
 }
 
 
@@ -791,6 +791,18 @@ void THnBase::Scale(Double_t c)
    SetEntries(nEntries);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill n points; x holds the GetNdimensions() coordinates of each point, one
+/// point after the other, and w (if not null) their n weights. This is
+/// equivalent to calling Fill(x + i * GetNdimensions(), w[i]) for each point,
+/// but THnSparse uses it to overlap the lookups of several bins.
+
+void THnBase::FillN(Long64_t n, const Double_t *x, const Double_t *w /*= nullptr*/)
+{
+   for (Long64_t i = 0; i < n; ++i)
+      Fill(x + i * fNdimensions, w ? w[i] : 1.);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add() implementation for both rebinned histograms and those with identical
 /// binning. See THnBase::Add().
@@ -813,34 +825,36 @@ void THnBase::AddInternal(const THnBase* h, Double_t c, Bool_t rebinned)
    }
    Int_t* coord = new Int_t[fNdimensions];
 
-   // Expand the exmap if needed, to reduce collisions
+   // Grow the bin index of sparse histograms only once
    Long64_t numTargetBins = GetNbins() + h->GetNbins();
    Reserve(numTargetBins);
 
-   Long64_t i = 0;
-   std::unique_ptr<ROOT::Internal::THnBaseBinIter> iter{h->CreateIter(false)};
    // Add to this whatever is found inside the other histogram
-   while ((i = iter->Next(coord)) >= 0) {
-      // Get the content of the bin from the second histogram
-      Double_t v = h->GetBinContent(i);
-
-      Long64_t mybinidx = -1;
-      if (rebinned) {
-         // Get the bin center given a coord
-         for (Int_t j = 0; j < fNdimensions; ++j)
-            x[j] = h->GetAxis(j)->GetBinCenter(coord[j]);
-
-         mybinidx = GetBin(x, kTRUE /* allocate*/);
-      } else {
-         mybinidx = GetBin(coord, kTRUE /*allocate*/);
-      }
+   if (rebinned || !AddCompatibleBins(h, c)) {
+      Long64_t i = 0;
+      std::unique_ptr<ROOT::Internal::THnBaseBinIter> iter{h->CreateIter(false)};
+      while ((i = iter->Next(coord)) >= 0) {
+         // Get the content of the bin from the second histogram
+         Double_t v = h->GetBinContent(i);
+
+         Long64_t mybinidx = -1;
+         if (rebinned) {
+            // Get the bin center given a coord
+            for (Int_t j = 0; j < fNdimensions; ++j)
+               x[j] = h->GetAxis(j)->GetBinCenter(coord[j]);
+
+            mybinidx = GetBin(x, kTRUE /* allocate*/);
+         } else {
+            mybinidx = GetBin(coord, kTRUE /*allocate*/);
+         }
 
-      if (haveErrors) {
-         Double_t err2 = h->GetBinError2(i) * c * c;
-         AddBinError2(mybinidx, err2);
+         if (haveErrors) {
+            Double_t err2 = h->GetBinError2(i) * c * c;
+            AddBinError2(mybinidx, err2);
+         }
+         // only _after_ error calculation, or sqrt(v) is taken into account!
+         AddBinContent(mybinidx, c * v);
       }
-      // only _after_ error calculation, or sqrt(v) is taken into account!
-      AddBinContent(mybinidx, c * v);
    }
 
    delete [] coord;
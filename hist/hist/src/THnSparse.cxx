@@ -16,6 +16,9 @@
 #include "TDataMember.h"
 #include "TDataType.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace {
 //______________________________________________________________________________
 //
@@ -318,9 +321,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
-   // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // If it does, we can use it as a "perfect hash" for THnSparseBinIndex.
+   // If not we build a hash from the compact bin index, combining it
+   // 8 bytes at a time, and use that as the THnSparseBinIndex's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -331,10 +334,11 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 
    // else: doesn't fit into a Long64_t:
    ULong64_t hash = 5381;
-   const Char_t* str = buf;
-   while (str - buf < fCoordBufferSize) {
-      hash *= 5;
-      hash += *(str++);
+   for (Int_t offset = 0; offset < fCoordBufferSize; offset += 8) {
+      ULong64_t word = 0;
+      memcpy(&word, buf + offset, std::min(8, fCoordBufferSize - offset));
+      hash = (hash ^ word) * 0x9e3779b97f4a7c15ull;
+      hash ^= hash >> 32;
    }
    return hash;
 }
@@ -409,6 +413,100 @@ THnSparseCompactBinCoord::~THnSparseCompactBinCoord()
    delete [] fCurrentBin;
 }
 
+/** \class THnSparseBinIndex
+THnSparseBinIndex is used internally by THnSparse to find the linear index
+of a filled bin from the hash of its compact coordinates. It is a hash table
+with open addressing and linear probing: each slot stores the hash next to
+the linear index, so that a lookup usually touches a single cache line, and
+the compact coordinates of a bin are only compared (by
+THnSparseArrayChunk::Matches()) if the hashes are equal. The number of slots
+is a power of two, and at most half of them are used.
+*/
+
+class THnSparseBinIndex {
+public:
+   Long64_t GetSize() const { return fSize; }
+   size_t GetMemorySize() const { return fSlots.size() * sizeof(Slot); }
+
+   /// Return the linear index of the bin with hash "hash" for which
+   /// "matches(index)" is true, or -1 if there is none.
+   template <class MATCHES>
+   Long64_t Find(ULong64_t hash, MATCHES &&matches) const {
+      if (fSlots.empty())
+         return -1;
+      for (ULong64_t pos = Mix(hash) & fMask; fSlots[pos].fIndex; pos = (pos + 1) & fMask) {
+         if (fSlots[pos].fHash == hash && matches(fSlots[pos].fIndex - 1))
+            return fSlots[pos].fIndex - 1;
+      }
+      return -1;
+   }
+
+   /// Add the bin with linear index "idx"; it must not be in the table yet.
+   void Insert(ULong64_t hash, Long64_t idx) {
+      if (2 * (ULong64_t)(fSize + 1) > fSlots.size())
+         Reserve(fSize + 1);
+      InsertSlot({hash, idx + 1});
+      ++fSize;
+   }
+
+   /// Hint the processor to load the slot where the lookup of "hash" starts.
+   void Prefetch(ULong64_t hash) const {
+#if defined(__GNUC__) || defined(__clang__)
+      if (!fSlots.empty())
+         __builtin_prefetch(&fSlots[Mix(hash) & fMask]);
+#else
+      (void)hash;
+#endif
+   }
+
+   /// Make room for nbins bins without growing the table.
+   void Reserve(Long64_t nbins) {
+      size_t nslots = 16;
+      while (nslots < 2 * (ULong64_t)nbins)
+         nslots *= 2;
+      if (nslots <= fSlots.size())
+         return;
+      std::vector<Slot> oldSlots(nslots);
+      fSlots.swap(oldSlots);
+      fMask = nslots - 1;
+      for (const Slot &slot : oldSlots)
+         if (slot.fIndex)
+            InsertSlot(slot);
+   }
+
+   void Clear() {
+      std::vector<Slot>().swap(fSlots);
+      fMask = 0;
+      fSize = 0;
+   }
+
+private:
+   struct Slot {
+      ULong64_t fHash = 0;
+      Long64_t fIndex = 0; ///< Linear index of the bin + 1; 0 for an empty slot
+   };
+
+   /// Spread the hash over all bits; compact coordinates that are used as
+   /// hash only differ in their low bits.
+   static ULong64_t Mix(ULong64_t hash) {
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdull;
+      hash ^= hash >> 33;
+      return hash;
+   }
+
+   void InsertSlot(const Slot &slot) {
+      ULong64_t pos = Mix(slot.fHash) & fMask;
+      while (fSlots[pos].fIndex)
+         pos = (pos + 1) & fMask;
+      fSlots[pos] = slot;
+   }
+
+   std::vector<Slot> fSlots; // power-of-two number of slots
+   ULong64_t fMask = 0;      // number of slots - 1
+   Long64_t fSize = 0;       // number of used slots
+};
+
 /** \class THnSparseArrayChunk
 THnSparseArrayChunk is used internally by THnSparse.
 THnSparse stores its (dynamic size) array of bin coordinates and their
@@ -523,7 +621,8 @@ axis. A TH2 h("h","h",10, 0., 10., 20, -5., 5.) would correspond to
 A THnSparse is filled just like a regular histogram, using
 THnSparse::Fill(x, weight), where x is a n-dimensional Double_t value.
 To take errors into account, Sumw2() must be called before filling the
-histogram.
+histogram. Many points can be filled at once with THnSparse::FillN(), which
+is faster for histograms with many filled bins.
 
 Bins are allocated as needed; the status of the allocation can be observed
 by GetSparseFractionBins(), GetSparseFractionMem().
@@ -569,15 +668,14 @@ chunk is represented by an object of class THnSparseArrayChunk.
 Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
-if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+if it takes less than 8 bytes, the size of a Long64_t).
+This hash is used to lookup the linear index in the open-addressing hash
+table fBinIndex, whose slots store the hash of each filled bin next to its
+linear index. Only if the hashes are equal, the coordinates of the bin are
+compared to the coordinates passed to GetBin(). If they do not match, these
+two coordinates have the same hash - which is extremely unlikely but (for
+the case where the compact bin coordinates are larger than 8 bytes)
+possible; the lookup then continues with the next slots of the table.
 */
 
 
@@ -587,7 +685,7 @@ ClassImp(THnSparse);
 /// Construct an empty THnSparse.
 
 THnSparse::THnSparse():
-   fChunkSize(1024), fFilledBins(0), fCompactCoord(nullptr)
+   fChunkSize(1024), fFilledBins(0), fBinIndex(new THnSparseBinIndex), fCompactCoord(nullptr)
 {
    fBinContent.SetOwner();
 }
@@ -604,7 +702,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
                      const Int_t* nbins, const Double_t* xmin, const Double_t* xmax,
                      Int_t chunksize):
    THnBase(name, title, dim, nbins, xmin, xmax),
-   fChunkSize(chunksize), fFilledBins(0), fCompactCoord(nullptr)
+   fChunkSize(chunksize), fFilledBins(0), fBinIndex(new THnSparseBinIndex), fCompactCoord(nullptr)
 {
    fCompactCoord = new THnSparseCompactBinCoord(dim, nbins);
    fBinContent.SetOwner();
@@ -614,6 +712,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
 /// Destruct a THnSparse
 
 THnSparse::~THnSparse() {
+   delete fBinIndex;
    delete fCompactCoord;
 }
 
@@ -650,36 +749,23 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+///We have been streamed; set up fBinIndex
 
-void THnSparse::FillExMap()
+void THnSparse::FillBinIndex()
 {
    TIter iChunk(&fBinContent);
    THnSparseArrayChunk* chunk = nullptr;
-   THnSparseCoordCompression compactCoord(*GetCompactCoord());
+   const THnSparseCoordCompression& compactCoord = *GetCompactCoord();
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
+   fBinIndex->Reserve(GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      // bins are unique, no need to look them up
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         fBinIndex->Insert(compactCoord.GetHashFromBuffer(buf), idx);
    }
 }
 
@@ -687,12 +773,10 @@ void THnSparse::FillExMap()
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
-      FillExMap();
-   }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
+   if (!fBinIndex->GetSize() && fBinContent.GetEntriesFast()) {
+      FillBinIndex();
    }
+   fBinIndex->Reserve(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -736,6 +820,43 @@ Long64_t THnSparse::GetBin(const Int_t* coord, Bool_t allocate /*= kTRUE*/)
    return GetBinIndexForCurrentBin(allocate);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill n points; x holds the GetNdimensions() coordinates of each point, one
+/// point after the other, and w (if not null) their n weights.
+/// The points are processed in blocks: the compact coordinates of all points
+/// of a block are computed first, while the slots of the bin index needed to
+/// look them up are loaded into the cache, and then the bins are filled.
+
+void THnSparse::FillN(Long64_t n, const Double_t* x, const Double_t* w /*= nullptr*/)
+{
+   constexpr Long64_t kBlockSize = 32;
+   const THnSparseCompactBinCoord* cc = GetCompactCoord();
+   // SetBufferFromCoord() writes at least 8 bytes
+   const Int_t bufSize = std::max<Int_t>(cc->GetBufferSize(), sizeof(ULong64_t));
+   std::vector<Char_t> buffers(kBlockSize * bufSize);
+   std::vector<Int_t> coord(fNdimensions);
+   ULong64_t hashes[kBlockSize];
+
+   if (!fBinIndex->GetSize() && fBinContent.GetEntriesFast())
+      FillBinIndex();
+
+   for (Long64_t first = 0; first < n; first += kBlockSize) {
+      const Long64_t blockSize = std::min(kBlockSize, n - first);
+      const Double_t* xblock = x + first * fNdimensions;
+      for (Long64_t i = 0; i < blockSize; ++i) {
+         for (Int_t d = 0; d < fNdimensions; ++d)
+            coord[d] = GetAxis(d)->FindBin(xblock[i * fNdimensions + d]);
+         hashes[i] = cc->SetBufferFromCoord(coord.data(), &buffers[i * bufSize]);
+         fBinIndex->Prefetch(hashes[i]);
+      }
+      for (Long64_t i = 0; i < blockSize; ++i) {
+         const Double_t wi = w ? w[first + i] : 1.;
+         UpdateXStat(xblock + i * fNdimensions, wi);
+         FillBin(GetBinIndexForBuffer(&buffers[i * bufSize], hashes[i], kTRUE), wi);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the content of the filled bin number "idx".
 /// If coord is non-null, it will contain the bin's coordinates for each axis
@@ -789,22 +910,25 @@ Double_t THnSparse::GetBinError2(Long64_t linidx) const {
 Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
-   ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
-      FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
+   return GetBinIndexForBuffer(cc->GetBuffer(), cc->GetHash(), allocate);
+}
 
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
+////////////////////////////////////////////////////////////////////////////////
+/// Return the index of the bin with compact coordinates buf, whose hash is
+/// "hash". If it doesn't exist then return -1, or allocate a new bin if
+/// allocate is set
 
-      linidx = nextlinidx;
-   }
-   if (!allocate) return -1;
+Long64_t THnSparse::GetBinIndexForBuffer(const Char_t* buf, ULong64_t hash, Bool_t allocate)
+{
+   if (fBinContent.GetEntriesFast() && !fBinIndex->GetSize())
+      FillBinIndex();
+   // compact coordinates of up to 8 bytes are their own hash
+   const Bool_t hashIsCoord = GetCompactCoord()->GetBufferSize() <= 8;
+   const Long64_t linidx = fBinIndex->Find(hash, [&](Long64_t idx) {
+      return hashIsCoord || GetChunk(idx / fChunkSize)->Matches(idx % fChunkSize, buf);
+   });
+   if (linidx >= 0 || !allocate)
+      return linidx;
 
    ++fFilledBins;
 
@@ -815,23 +939,48 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
       chunk = AddChunk();
       newidx = 0;
    }
-   chunk->AddBin(newidx, cc->GetBuffer());
+   chunk->AddBin(newidx, buf);
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   fBinIndex->Insert(hash, newidx);
    return newidx;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add the bins of h scaled by c if it is a THnSparse with the same number
+/// of bins on each axis: its compact coordinates can then be looked up
+/// directly, without converting them to and from bin coordinates.
+
+Bool_t THnSparse::AddCompatibleBins(const THnBase* h, Double_t c)
+{
+   const THnSparse* other = dynamic_cast<const THnSparse*>(h);
+   if (!other || other->GetNdimensions() != fNdimensions)
+      return kFALSE;
+   for (Int_t d = 0; d < fNdimensions; ++d)
+      if (other->GetAxis(d)->GetNbins() != GetAxis(d)->GetNbins())
+         return kFALSE;
+
+   const Bool_t haveErrors = GetCalculateErrors();
+   const Bool_t otherHasErrors = other->GetCalculateErrors();
+   const THnSparseCoordCompression& compactCoord = *GetCompactCoord();
+   // adding a histogram to itself is fine: all its bins are found, none is allocated
+   const Int_t nChunks = other->GetNChunks();
+   for (Int_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+      const THnSparseArrayChunk* chunk = other->GetChunk(iChunk);
+      const Int_t nEntries = chunk->GetEntries();
+      for (Int_t i = 0; i < nEntries; ++i) {
+         const Char_t* buf = chunk->fCoordinates + i * chunk->fSingleCoordinateSize;
+         const Long64_t bin = GetBinIndexForBuffer(buf, compactCoord.GetHashFromBuffer(buf), kTRUE);
+         const Double_t v = chunk->fContent->GetAt(i);
+         if (haveErrors)
+            AddBinError2(bin, (otherHasErrors ? chunk->fSumw2->GetAt(i) : v) * c * c);
+         AddBinContent(bin, c * v);
+      }
+   }
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return THnSparseCompactBinCoord object.
 
@@ -880,7 +1029,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += fBinIndex->GetMemorySize();
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +1111,7 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   fBinIndex->Clear();
    fBinContent.Delete();
    ResetBase(option);
 }
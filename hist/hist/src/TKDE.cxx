@@ -22,6 +22,15 @@
 
  The algorithm is briefly described in (4). A binned version is also implemented to address the
  performance issue due to its data size dependance.
+
+ For large data sets, the evaluation can also be approximated with SetEvaluation(TKDE::kGridEvaluation):
+ the data are linearly binned on a fine grid, the density is computed once at all grid points with an FFT
+ convolution, and each evaluation interpolates between grid points. The cost of the set up is
+ O(N + M log M) for N data points and M grid points, and each evaluation takes constant time. With the adaptive
+ iteration, the pilot density used to compute the local bandwidths is itself evaluated on the grid, and the data
+ are grouped in classes of similar bandwidths, each convolved separately. The tolerance given to SetEvaluation()
+ controls the grid spacing, the kernel truncation and the width of the bandwidth classes; the difference to the
+ exact evaluation is of the order of the tolerance times the maximum of the density.
  */
 
 
@@ -31,6 +40,7 @@
 #include <numeric>
 #include <limits>
 #include <cassert>
+#include <complex>
 
 #include "Math/Error.h"
 #include "TMath.h"
@@ -46,6 +56,39 @@
 
 ClassImp(TKDE);
 
+namespace {
+
+/// In-place radix-2 FFT of a, whose size must be a power of 2. The inverse transform is not normalized.
+void FFT(std::vector<std::complex<Double_t>> &a, bool inverse)
+{
+   const size_t n = a.size();
+   for (size_t i = 1, j = 0; i < n; ++i) {
+      size_t bit = n >> 1;
+      for (; j & bit; bit >>= 1)
+         j ^= bit;
+      j ^= bit;
+      if (i < j)
+         std::swap(a[i], a[j]);
+   }
+   // twiddle factors computed once, to avoid the accumulation of rounding errors
+   std::vector<std::complex<Double_t>> twiddles(n / 2);
+   for (size_t k = 0; k < n / 2; ++k)
+      twiddles[k] = std::polar(1., (inverse ? 2. : -2.) * M_PI * k / n);
+   for (size_t len = 2; len <= n; len <<= 1) {
+      const size_t step = n / len;
+      for (size_t i = 0; i < n; i += len) {
+         for (size_t j = 0; j < len / 2; ++j) {
+            const std::complex<Double_t> u = a[i + j];
+            const std::complex<Double_t> v = a[i + j + len / 2] * twiddles[j * step];
+            a[i + j] = u + v;
+            a[i + j + len / 2] = u - v;
+         }
+      }
+   }
+}
+
+} // anonymous namespace
+
 
 struct TKDE::KernelIntegrand {
    enum EIntegralResult{kNorm, kMu, kSigma2, kUnitIntegration};
@@ -70,8 +113,9 @@ TKDE::TKDE() :
    fUseBins(false), fNewData(false), fUseMinMaxFromData(false),
    fNBins(0), fNEvents(0), fSumOfCounts(0), fUseBinsNEvents(0),
    fMean(0.),fSigma(0.), fSigmaRob(0.), fXMin(0.), fXMax(0.),
-   fRho(0.), fAdaptiveBandwidthFactor(0.), fWeightSize(0)
+   fRho(0.), fAdaptiveBandwidthFactor(0.), fWeightSize(0), fTolerance(1.E-4)
 {
+   fEvaluation = kExactEvaluation;
 }
 
 TKDE::~TKDE() {
@@ -111,6 +155,8 @@ void TKDE::Instantiate(KernelFunction_Ptr kernfunc, UInt_t events, const Double_
    fAdaptiveBandwidthFactor = 1.;
    fRho = rho;
    fWeightSize = 0;
+   fEvaluation = kExactEvaluation;
+   fTolerance = 1.E-4;
    fCanonicalBandwidths = std::vector<Double_t>(kTotalKernels, 0.0);
    fKernelSigmas2 = std::vector<Double_t>(kTotalKernels, -1.0);
    fSettedOptions = std::vector<Bool_t>(4, kFALSE);
@@ -389,6 +435,23 @@ void TKDE::SetRange(Double_t xMin, Double_t xMax) {
    fKernel.reset();
 }
 
+void TKDE::SetEvaluation(EEvaluation eval, Double_t tolerance) {
+   // Sets the evaluation of the density estimate: exact (kExactEvaluation, the default) or interpolated on a grid
+   // (kGridEvaluation). The tolerance is the relative accuracy of the grid evaluation with respect to the maximum
+   // of the density; it is ignored by the exact evaluation.
+   if (eval != kExactEvaluation && eval != kGridEvaluation) {
+      Warning("SetEvaluation", "Illegal evaluation type input - use exact evaluation !");
+      eval = kExactEvaluation;
+   }
+   if (!(tolerance > 0. && tolerance < 1.)) {
+      Warning("SetEvaluation", "Tolerance %g must be in (0, 1) - use default value 1.E-4 !", tolerance);
+      tolerance = 1.E-4;
+   }
+   fEvaluation = eval;
+   fTolerance = tolerance;
+   fKernel.reset();
+}
+
 // private methods
 
 void TKDE::SetUseBins() {
@@ -605,8 +668,13 @@ void TKDE::SetKernel() {
 
    fKernel = std::make_unique<TKernel>(weight, this);
 
+   // with the grid evaluation, the pilot density of the adaptive iteration is evaluated on the grid as well
+   if (fEvaluation == kGridEvaluation)
+      fKernel->ComputeGrid();
    if (fIteration == kAdaptive) {
       fKernel->ComputeAdaptiveWeights();
+      if (fEvaluation == kGridEvaluation)
+         fKernel->ComputeGrid();
    }
    if (gDebug) {
       if (fIteration != kAdaptive)
@@ -811,6 +879,114 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    //printf("adaptive bandwidth factor % f weight 0 %f , %f \n",fKDE->fAdaptiveBandwidthFactor, weights[0],fWeights[0] );
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the density estimate on a grid for kGridEvaluation.
+/// The data points (or bins) are linearly binned on a grid whose spacing is a fraction sqrt(tolerance)
+/// of the smallest bandwidth, and convolved with the kernel using FFTs. With adaptive weights, the points
+/// are grouped in classes of bandwidths differing by less than a relative sqrt(tolerance); the transforms of the
+/// convolutions of all the classes are summed, so that a single inverse FFT is needed.
+
+void TKDE::TKernel::ComputeGrid() {
+   fGrid.clear();
+   const UInt_t n = fKDE->fData.size();
+   if (n == 0)
+      return;
+   const Bool_t useCount = (fKDE->fBinCount.size() == n);
+   const Bool_t hasAdaptiveWeights = (fWeights.size() == n);
+
+   // the points entering the sum of TKernel::operator(), including the asymmetric mirrors
+   std::vector<Double_t> points, counts, bandwidths;
+   const UInt_t nCopies = 1 + fKDE->fAsymLeft + fKDE->fAsymRight;
+   points.reserve(nCopies * n);
+   counts.reserve(nCopies * n);
+   bandwidths.reserve(nCopies * n);
+   for (UInt_t i = 0; i < n; ++i) {
+      const Double_t w = hasAdaptiveWeights ? fWeights[i] : fWeights[0];
+      // points with 0 bandwidth are skipped, see TKernel::ComputeAdaptiveWeights
+      if (w <= 0)
+         continue;
+      const Double_t count = useCount ? fKDE->fBinCount[i] : 1.;
+      const Double_t x = fKDE->fData[i];
+      points.push_back(x);
+      if (fKDE->fAsymLeft)
+         points.push_back(2. * fKDE->fXMin - x);
+      if (fKDE->fAsymRight)
+         points.push_back(2. * fKDE->fXMax - x);
+      counts.insert(counts.end(), points.size() - counts.size(), count);
+      bandwidths.insert(bandwidths.end(), points.size() - bandwidths.size(), w);
+   }
+   if (points.empty())
+      return;
+
+   const Double_t tolerance = fKDE->fTolerance;
+   const Double_t support = fKDE->ComputeKernelSupport();
+   const Double_t minBandwidth = *std::min_element(bandwidths.begin(), bandwidths.end());
+   const Double_t maxBandwidth = *std::max_element(bandwidths.begin(), bandwidths.end());
+   const Double_t xMin = *std::min_element(points.begin(), points.end()) - support * maxBandwidth;
+   const Double_t xMax = *std::max_element(points.begin(), points.end()) + support * maxBandwidth;
+
+   constexpr size_t kMaxGridSize = 1 << 22;
+   fGridDelta = std::sqrt(tolerance) * minBandwidth;
+   if ((xMax - xMin) / fGridDelta > kMaxGridSize - 1) {
+      fGridDelta = (xMax - xMin) / (kMaxGridSize - 1);
+      fKDE->Warning("ComputeGrid", "Grid limited to %zu points: the accuracy is lower than the tolerance %g",
+                    kMaxGridSize, tolerance);
+   }
+   fGridMin = xMin;
+   const size_t gridSize = size_t((xMax - xMin) / fGridDelta) + 2;
+   const size_t maxKernelSize = size_t(support * maxBandwidth / fGridDelta) + 1;
+   size_t fftSize = 1;
+   while (fftSize < gridSize + 2 * maxKernelSize)
+      fftSize <<= 1;
+
+   // classes of bandwidths differing by at most a factor classRatio
+   const Double_t classRatio = 1. + std::sqrt(tolerance);
+   const Double_t logClassRatio = std::log(classRatio);
+   auto classOf = [&](Double_t w) { return size_t(std::log(w / minBandwidth) / logClassRatio); };
+   const size_t nClasses = hasAdaptiveWeights ? classOf(maxBandwidth) + 1 : 1;
+   std::vector<std::vector<size_t>> pointsOfClass(nClasses);
+   for (size_t i = 0; i < points.size(); ++i)
+      pointsOfClass[hasAdaptiveWeights ? classOf(bandwidths[i]) : 0].push_back(i);
+
+   std::vector<std::complex<Double_t>> sum(fftSize);
+   std::vector<std::complex<Double_t>> binned(fftSize);
+   std::vector<std::complex<Double_t>> kernel(fftSize);
+   for (size_t c = 0; c < nClasses; ++c) {
+      if (pointsOfClass[c].empty())
+         continue;
+      const Double_t w =
+         hasAdaptiveWeights ? minBandwidth * std::pow(classRatio, c + 0.5) : fWeights[0];
+      // linear binning: each count is shared by the two nearest grid points
+      std::fill(binned.begin(), binned.end(), 0.);
+      for (size_t i : pointsOfClass[c]) {
+         const Double_t pos = (points[i] - fGridMin) / fGridDelta;
+         const size_t bin = size_t(pos);
+         const Double_t frac = pos - bin;
+         binned[bin] += counts[i] * (1. - frac);
+         binned[bin + 1] += counts[i] * frac;
+      }
+      // kernel sampled at the grid spacing, wrapped around for negative distances
+      std::fill(kernel.begin(), kernel.end(), 0.);
+      const size_t kernelSize = std::min(size_t(support * w / fGridDelta) + 1, maxKernelSize);
+      const Double_t invWeight = 1. / w;
+      kernel[0] = invWeight * (*fKDE->fKernelFunction)(0.);
+      for (size_t m = 1; m <= kernelSize; ++m) {
+         kernel[m] = invWeight * (*fKDE->fKernelFunction)(m * fGridDelta * invWeight);
+         kernel[fftSize - m] = invWeight * (*fKDE->fKernelFunction)(-(m * fGridDelta * invWeight));
+      }
+      FFT(binned, false);
+      FFT(kernel, false);
+      for (size_t k = 0; k < fftSize; ++k)
+         sum[k] += binned[k] * kernel[k];
+   }
+   FFT(sum, true);
+
+   const Double_t norm = 1. / (fftSize * fKDE->fSumOfCounts);
+   fGrid.resize(gridSize);
+   for (size_t k = 0; k < gridSize; ++k)
+      fGrid[k] = sum[k].real() * norm;
+}
+
 Double_t TKDE::TKernel::GetWeight(Double_t x) const {
    // Returns the bandwidth
    return fWeights[fKDE->Index(x)];
@@ -1009,6 +1185,15 @@ const std::vector<Double_t> & TKDE::TKernel::GetAdaptiveWeights() const {
 
 Double_t TKDE::TKernel::operator()(Double_t x) const {
    // The internal class's unary function: returns the kernel density estimate
+   if (!fGrid.empty()) {
+      // kGridEvaluation: linear interpolation between the grid points
+      const Double_t pos = (x - fGridMin) / fGridDelta;
+      if (!(pos >= 0. && pos < fGrid.size() - 1))
+         return 0.;
+      const size_t bin = size_t(pos);
+      const Double_t frac = pos - bin;
+      return (1. - frac) * fGrid[bin] + frac * fGrid[bin + 1];
+   }
    Double_t result(0.0);
    UInt_t n = fKDE->fData.size();
    // case of bins or weighted data
@@ -1148,6 +1333,30 @@ Double_t TKDE::ComputeKernelMu() const {
    return result;
 }
 
+Double_t TKDE::ComputeKernelSupport() const {
+   // Computes the distance, in units of the bandwidth, beyond which the kernel is smaller than the tolerance
+   // relative to its central value
+   switch (fKernelType) {
+   case kGaussian:
+      // the Gaussian kernel is truncated at 9
+      return std::min(9., std::sqrt(-2. * std::log(fTolerance)));
+   case kEpanechnikov:
+   case kBiweight:
+   case kCosineArch:
+      return 1.;
+   default: {
+      const Double_t threshold = fTolerance * std::abs((*fKernelFunction)(0.));
+      const Double_t step = 0.01;
+      Double_t support = step;
+      for (Double_t t = step; t < 100.; t += step) {
+         if (std::abs((*fKernelFunction)(t)) > threshold || std::abs((*fKernelFunction)(-t)) > threshold)
+            support = t + step;
+      }
+      return support;
+   }
+   }
+}
+
 Double_t TKDE::ComputeKernelIntegral() const {
    // Computes the kernel's integral which ought to be unity
    ROOT::Math::IntegratorOneDim ig(ROOT::Math::IntegrationOneDim::kGAUSS);
@@ -1,8 +1,13 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
+#include "TRandom3.h"
+
+#include <map>
+#include <vector>
 
 // Filling THn
 TEST(THn, Fill) {
@@ -144,3 +149,109 @@ TEST(THn, GetBinCenter)
    EXPECT_DOUBLE_EQ(centers.at(0), 2.5);
    EXPECT_DOUBLE_EQ(centers.at(1), -1.5);
 }
+
+// 10 dimensions with 100 bins each need more than 8 bytes of compact coordinates,
+// so the bins are looked up through a hash that can collide.
+static THnSparseD MakeLargeSparse(const char *name)
+{
+   const Int_t nDim = 10;
+   std::vector<Int_t> bins(nDim, 100);
+   std::vector<Double_t> xmin(nDim, 0.);
+   std::vector<Double_t> xmax(nDim, 1.);
+   return THnSparseD(name, name, nDim, bins.data(), xmin.data(), xmax.data(), 128);
+}
+
+static std::vector<Double_t> MakeSparsePoints(Int_t nDim, Int_t n, UInt_t seed)
+{
+   TRandom3 rnd(seed);
+   std::vector<Double_t> x(n * nDim);
+   for (auto &xi : x)
+      xi = 0.1 * rnd.Integer(12) - 0.05; // few distinct values, including underflows and overflows
+   return x;
+}
+
+TEST(THnSparse, LookupLargeCoordinates)
+{
+   THnSparseD hs = MakeLargeSparse("hs");
+   const Int_t nDim = hs.GetNdimensions();
+   const Int_t n = 20000;
+   const auto x = MakeSparsePoints(nDim, n, 1);
+
+   std::map<std::vector<Int_t>, Double_t> expected;
+   for (Int_t i = 0; i < n; ++i) {
+      std::vector<Int_t> coord(nDim);
+      for (Int_t d = 0; d < nDim; ++d)
+         coord[d] = hs.GetAxis(d)->FindBin(x[i * nDim + d]);
+      expected[coord] += i % 3 + 1;
+      hs.Fill(x.data() + i * nDim, i % 3 + 1);
+   }
+
+   EXPECT_EQ(Long64_t(expected.size()), hs.GetNbins());
+   for (const auto &bin : expected)
+      EXPECT_DOUBLE_EQ(bin.second, hs.GetBinContent(bin.first.data()));
+
+   std::vector<Int_t> missing(nDim, 57);
+   EXPECT_EQ(-1, hs.GetBin(missing.data(), kFALSE));
+}
+
+TEST(THnSparse, FillNMatchesFill)
+{
+   THnSparseD hFill = MakeLargeSparse("hFill");
+   THnSparseD hFillN = MakeLargeSparse("hFillN");
+   hFill.Sumw2();
+   hFillN.Sumw2();
+   const Int_t nDim = hFill.GetNdimensions();
+   const Int_t n = 10001; // not a multiple of the block size
+   const auto x = MakeSparsePoints(nDim, n, 2);
+   std::vector<Double_t> w(n);
+   for (Int_t i = 0; i < n; ++i) {
+      w[i] = 0.5 + i % 4;
+      hFill.Fill(x.data() + i * nDim, w[i]);
+   }
+   hFillN.FillN(n, x.data(), w.data());
+
+   EXPECT_EQ(hFill.GetNbins(), hFillN.GetNbins());
+   EXPECT_DOUBLE_EQ(hFill.GetEntries(), hFillN.GetEntries());
+   EXPECT_DOUBLE_EQ(hFill.GetWeightSum(), hFillN.GetWeightSum());
+   // both fill the bins in the same order
+   std::vector<Int_t> coord(nDim);
+   std::vector<Int_t> coordN(nDim);
+   for (Long64_t bin = 0; bin < hFill.GetNbins(); ++bin) {
+      EXPECT_DOUBLE_EQ(hFill.GetBinContent(bin, coord.data()), hFillN.GetBinContent(bin, coordN.data()));
+      EXPECT_EQ(coord, coordN);
+      EXPECT_DOUBLE_EQ(hFill.GetBinError2(bin), hFillN.GetBinError2(bin));
+   }
+}
+
+TEST(THnSparse, AddMatchesRebinnedAdd)
+{
+   THnSparseD h1 = MakeLargeSparse("h1");
+   THnSparseD h2 = MakeLargeSparse("h2");
+   h2.Sumw2();
+   const Int_t nDim = h1.GetNdimensions();
+   const auto x1 = MakeSparsePoints(nDim, 5000, 3);
+   const auto x2 = MakeSparsePoints(nDim, 5000, 4);
+   h1.FillN(5000, x1.data());
+   h2.FillN(5000, x2.data());
+
+   // RebinnedAdd() looks up the bins from their coordinates, Add() from their compact coordinates
+   THnSparseD hAdd = MakeLargeSparse("hAdd");
+   THnSparseD hRebinnedAdd = MakeLargeSparse("hRebinnedAdd");
+   for (auto h : {&hAdd, &hRebinnedAdd}) {
+      h->Add(&h1);
+      h->Sumw2();
+   }
+   hAdd.Add(&h2, 2.);
+   hRebinnedAdd.RebinnedAdd(&h2, 2.);
+
+   EXPECT_EQ(hRebinnedAdd.GetNbins(), hAdd.GetNbins());
+   EXPECT_DOUBLE_EQ(hRebinnedAdd.GetWeightSum(), hAdd.GetWeightSum());
+   std::vector<Int_t> coord(nDim);
+   for (Long64_t bin = 0; bin < hRebinnedAdd.GetNbins(); ++bin) {
+      const Double_t content = hRebinnedAdd.GetBinContent(bin, coord.data());
+      const Long64_t addBin = hAdd.GetBin(coord.data(), kFALSE);
+      ASSERT_GE(addBin, 0);
+      EXPECT_DOUBLE_EQ(content, hAdd.GetBinContent(addBin));
+      EXPECT_DOUBLE_EQ(hRebinnedAdd.GetBinError2(bin), hAdd.GetBinError2(addBin));
+   }
+}
@@ -0,0 +1,138 @@
+#include "gtest/gtest.h"
+
+#include "ROOT/TConcurrentHistFill.hxx"
+#include "TH1D.h"
+#include "TH2F.h"
+#include "TH3D.h"
+#include "THn.h"
+#include "TProfile.h"
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace {
+constexpr int kNThreads = 4;
+constexpr int kNEntriesPerThread = 10000;
+
+// deterministic values in [-0.1, 1.1), the same for a given entry whichever thread fills it
+double Value(int entry, int coord)
+{
+   return -0.1 + std::fmod((entry + 1) * (0.618034 + coord * 0.1), 1.2);
+}
+
+template <typename HIST, typename FILL>
+void FillConcurrently(HIST &h, unsigned int bufferSize, FILL fill)
+{
+   ROOT::TConcurrentHistFillManager<HIST> manager(h, bufferSize);
+   std::vector<std::thread> threads;
+   for (int t = 0; t < kNThreads; ++t) {
+      threads.emplace_back([&manager, &fill, t] {
+         auto filler = manager.MakeFiller();
+         for (int i = t * kNEntriesPerThread; i < (t + 1) * kNEntriesPerThread; ++i)
+            fill(filler, i);
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+}
+
+void ExpectSameContent(const TH1 &h1, const TH1 &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_DOUBLE_EQ(h1.GetBinError(bin), h2.GetBinError(bin)) << "bin " << bin;
+   }
+   EXPECT_NEAR(h1.GetMean(), h2.GetMean(), 1e-12);
+   EXPECT_NEAR(h1.GetStdDev(), h2.GetStdDev(), 1e-12);
+}
+} // namespace
+
+TEST(TConcurrentHistFill, TH1)
+{
+   TH1D ref("ref", "ref", 100, 0., 1.);
+   for (int i = 0; i < kNThreads * kNEntriesPerThread; ++i)
+      ref.Fill(Value(i, 0), 1. + i % 3);
+
+   TH1D h("h", "h", 100, 0., 1.);
+   FillConcurrently(h, 100, [](auto &filler, int i) { filler.Fill(Value(i, 0), 1. + i % 3); });
+   ExpectSameContent(ref, h);
+}
+
+TEST(TConcurrentHistFill, TH2)
+{
+   TH2F ref("ref", "ref", 20, 0., 1., 30, 0., 1.);
+   for (int i = 0; i < kNThreads * kNEntriesPerThread; ++i)
+      ref.Fill(Value(i, 0), Value(i, 1));
+
+   TH2F h("h", "h", 20, 0., 1., 30, 0., 1.);
+   FillConcurrently(h, 1000, [](auto &filler, int i) { filler.Fill(Value(i, 0), Value(i, 1)); });
+   ExpectSameContent(ref, h);
+}
+
+TEST(TConcurrentHistFill, TH3)
+{
+   TH3D ref("ref", "ref", 10, 0., 1., 10, 0., 1., 10, 0., 1.);
+   for (int i = 0; i < kNThreads * kNEntriesPerThread; ++i)
+      ref.Fill(Value(i, 0), Value(i, 1), Value(i, 2), 2.);
+
+   TH3D h("h", "h", 10, 0., 1., 10, 0., 1., 10, 0., 1.);
+   FillConcurrently(h, 333, [](auto &filler, int i) { filler.Fill(Value(i, 0), Value(i, 1), Value(i, 2), 2.); });
+   ExpectSameContent(ref, h);
+}
+
+TEST(TConcurrentHistFill, THn)
+{
+   const Int_t bins[] = {10, 10, 10, 10};
+   const Double_t xmin[] = {0., 0., 0., 0.};
+   const Double_t xmax[] = {1., 1., 1., 1.};
+   THnD ref("ref", "ref", 4, bins, xmin, xmax);
+   THnD h("h", "h", 4, bins, xmin, xmax);
+   auto point = [](int i) { return std::vector<double>{Value(i, 0), Value(i, 1), Value(i, 2), Value(i, 3)}; };
+   for (int i = 0; i < kNThreads * kNEntriesPerThread; ++i)
+      ref.Fill(point(i).data());
+
+   FillConcurrently(h, 64, [&point](auto &filler, int i) { filler.Fill(point(i).data()); });
+   EXPECT_EQ(ref.GetEntries(), h.GetEntries());
+   for (Long64_t bin = 0; bin < ref.GetNbins(); ++bin)
+      EXPECT_EQ(ref.GetBinContent(bin), h.GetBinContent(bin)) << "bin " << bin;
+}
+
+TEST(TConcurrentHistFill, Flush)
+{
+   TH1D h("h", "h", 10, 0., 1.);
+   ROOT::TConcurrentHistFillManager<TH1D> manager(h, 100);
+   auto filler = manager.MakeFiller();
+   filler.Fill(0.5);
+   EXPECT_EQ(h.GetEntries(), 0);
+   filler.Flush();
+   EXPECT_EQ(h.GetEntries(), 1);
+   EXPECT_THROW(filler.Fill(0.5, 1., 1.), std::invalid_argument);
+}
+
+TEST(TConcurrentHistFill, FillZero)
+{
+   // A literal 0 must fill the value 0 like TH1::Fill(0), not be taken as a null pointer to the coordinates
+   TH1D ref("ref", "ref", 10, -1., 1.);
+   ref.Fill(0);
+   ref.Fill(0., 2.);
+
+   TH1D h("h", "h", 10, -1., 1.);
+   {
+      ROOT::TConcurrentHistFillManager<TH1D> manager(h);
+      auto filler = manager.MakeFiller();
+      filler.Fill(0);
+      filler.Fill(0, 2);
+   }
+   ExpectSameContent(ref, h);
+}
+
+TEST(TConcurrentHistFill, Errors)
+{
+   TH1D h("h", "h", 10, 0., 1.);
+   EXPECT_THROW((ROOT::TConcurrentHistFillManager<TH1D>{h, 0}), std::invalid_argument);
+   TProfile p("p", "p", 10, 0., 1.);
+   EXPECT_THROW(ROOT::TConcurrentHistFillManager<TH1D>{p}, std::invalid_argument);
+}
@@ -1,9 +1,64 @@
 #include "gtest/gtest.h"
 
 #include "TFormula.h"
+#include "TF1.h"
+
+#include <vector>
 
 // Test that autoloading works (ROOT-9840)
 TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+// Test that the batched evaluation gives the same values as the evaluation point by point
+TEST(TFormula, EvalBatch)
+{
+   TFormula f1("f1", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]*sin(x)");
+   f1.SetParameters(10., 1., 2., 0.5);
+   std::vector<double> x(1000);
+   for (std::size_t i = 0; i < x.size(); ++i)
+      x[i] = -5. + 0.01 * i;
+   std::vector<double> result(x.size());
+   f1.EvalBatch(x, result);
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_DOUBLE_EQ(result[i], f1.EvalPar(&x[i]));
+
+   // with other parameters
+   const double params[] = {1., 0., 1., 2.};
+   f1.EvalBatch(x, result, params);
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_DOUBLE_EQ(result[i], f1.EvalPar(&x[i], params));
+
+   // two dimensions, the points are stored one after the other
+   TFormula f2("f2", "[0]*x*y + y*y");
+   f2.SetParameter(0, 3.);
+   std::vector<double> xy(2 * 100);
+   for (std::size_t i = 0; i < xy.size(); ++i)
+      xy[i] = 0.1 * i;
+   std::vector<double> result2(100);
+   f2.EvalBatch(xy, result2);
+   for (std::size_t i = 0; i < result2.size(); ++i)
+      EXPECT_DOUBLE_EQ(result2[i], f2.EvalPar(&xy[2 * i]));
+}
+
+// Test the batched evaluation of TF1 objects not defined by a formula
+TEST(TF1, EvalBatch)
+{
+   TF1 f("f", [](const double *x, const double *p) { return p[0] + p[1] * x[0] * x[0]; }, -10, 10, 2);
+   f.SetParameters(1., 2.);
+   std::vector<double> x(100);
+   for (std::size_t i = 0; i < x.size(); ++i)
+      x[i] = -5. + 0.1 * i;
+   std::vector<double> result(x.size());
+   f.EvalBatch(x, result);
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_DOUBLE_EQ(result[i], f.Eval(x[i]));
+
+   TF1 g("g", "gaus", -10, 10);
+   g.SetParameters(1., 0., 1.);
+   g.SetNormalized(true);
+   g.EvalBatch(x, result);
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_DOUBLE_EQ(result[i], g.EvalPar(&x[i]));
+}
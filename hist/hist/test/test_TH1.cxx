@@ -1,9 +1,18 @@
 #include "gtest/gtest.h"
 
+#include "RConfigure.h" // R__USE_IMT
 #include "TH1.h"
+#include "TH1D.h"
 #include "TH1F.h"
+#include "TH2D.h"
 #include "THLimitsFinder.h"
+#include "TList.h"
+#include "TRandom3.h"
+#include "TROOT.h"
 
+#include <cmath>
+#include <limits>
+#include <string>
 #include <vector>
 
 // StatOverflows TH1
@@ -63,3 +72,123 @@ TEST(TH1, SmoothArrayCrossCheck)
       EXPECT_FLOAT_EQ(arr2[i], 1.0);
    }
 }
+
+namespace {
+// values on the bin edges and outside of the axis range, plus a pseudo-random sequence
+std::vector<double> MakeFillValues(double xmin, double xmax, int nbins)
+{
+   const double width = (xmax - xmin) / nbins;
+   std::vector<double> values{xmin,
+                              xmax,
+                              xmin - 1.,
+                              xmax + 1.,
+                              std::numeric_limits<double>::quiet_NaN(),
+                              std::numeric_limits<double>::infinity(),
+                              -std::numeric_limits<double>::infinity()};
+   for (int i = 0; i <= nbins; ++i)
+      values.push_back(xmin + i * width);
+   for (int i = 0; i < 1000; ++i)
+      values.push_back(xmin - 0.1 * (xmax - xmin) + std::fmod(i * 0.618034, 1.2) * (xmax - xmin));
+   return values;
+}
+
+void ExpectSameHistograms(const TH1 &h1, const TH1 &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_EQ(h1.GetBinError(bin), h2.GetBinError(bin)) << "bin " << bin;
+   }
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+   double stats1[TH1::kNstat];
+   double stats2[TH1::kNstat];
+   h1.GetStats(stats1);
+   h2.GetStats(stats2);
+   for (int i = 0; i < TH1::kNstat; ++i)
+      EXPECT_DOUBLE_EQ(stats1[i], stats2[i]) << "stat " << i;
+}
+} // namespace
+
+// FillN must give the same result as calling Fill for each value
+TEST(TH1, FillNMatchesFill)
+{
+   const auto values = MakeFillValues(-1.3, 2.9, 37);
+   std::vector<double> weights;
+   for (std::size_t i = 0; i < values.size(); ++i)
+      weights.push_back(0.5 + (i % 7) * 0.25);
+
+   for (bool useWeights : {false, true}) {
+      TH1D h1("h1", "h1", 37, -1.3, 2.9);
+      TH1D h2("h2", "h2", 37, -1.3, 2.9);
+      for (std::size_t i = 0; i < values.size(); ++i)
+         useWeights ? h1.Fill(values[i], weights[i]) : h1.Fill(values[i]);
+      h2.FillN(values.size(), values.data(), useWeights ? weights.data() : nullptr);
+      ExpectSameHistograms(h1, h2);
+   }
+
+   // stride and variable bin sizes
+   const double edges[] = {-1., 0., 0.5, 2., 2.5, 4.};
+   TH1F h3("h3", "h3", 5, edges);
+   TH1F h4("h4", "h4", 5, edges);
+   for (std::size_t i = 0; i < values.size(); i += 2)
+      h3.Fill(values[i], weights[i]);
+   h4.FillN(values.size() / 2 + values.size() % 2, values.data(), weights.data(), 2);
+   ExpectSameHistograms(h3, h4);
+}
+
+TEST(TH2, FillNMatchesFill)
+{
+   const auto xs = MakeFillValues(0., 10., 20);
+   auto ys = MakeFillValues(-5., 5., 13);
+   ys.resize(xs.size(), 1.);
+   TH2D h1("h1", "h1", 20, 0., 10., 13, -5., 5.);
+   TH2D h2("h2", "h2", 20, 0., 10., 13, -5., 5.);
+   for (std::size_t i = 0; i < xs.size(); ++i)
+      h1.Fill(xs[i], ys[i]);
+   h2.FillN(xs.size(), xs.data(), ys.data(), nullptr);
+   ExpectSameHistograms(h1, h2);
+}
+
+// TH1::Merge splits large merges into ranges of bins when implicit multi-threading is enabled
+TEST(TH1, MergeParallelMatchesSequential)
+{
+   std::vector<TH2D> inputs;
+   inputs.reserve(8);
+   TRandom3 rnd(7);
+   for (int i = 0; i < 8; ++i) {
+      const std::string name = "input" + std::to_string(i);
+      inputs.emplace_back(name.c_str(), name.c_str(), 400, -1, 1, 400, -1, 1);
+      inputs.back().SetDirectory(nullptr);
+      inputs.back().Sumw2();
+      for (int j = 0; j < 20000; ++j)
+         inputs.back().Fill(rnd.Gaus(0, 0.4), rnd.Gaus(0, 0.4), rnd.Uniform());
+   }
+   TList list;
+   for (auto &h : inputs)
+      list.Add(&h);
+
+   TH2D sequential("sequential", "sequential", 400, -1, 1, 400, -1, 1);
+   sequential.SetDirectory(nullptr);
+   sequential.Sumw2();
+   sequential.Merge(&list);
+
+   TH2D parallel("parallel", "parallel", 400, -1, 1, 400, -1, 1);
+   parallel.SetDirectory(nullptr);
+   parallel.Sumw2();
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   parallel.Merge(&list);
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+
+   EXPECT_EQ(sequential.GetEntries(), parallel.GetEntries());
+   EXPECT_EQ(sequential.GetSumOfWeights(), parallel.GetSumOfWeights());
+   for (int bin = 0; bin < sequential.GetNcells(); ++bin) {
+      // bins are added in the same order, so the results are identical
+      EXPECT_EQ(sequential.GetBinContent(bin), parallel.GetBinContent(bin));
+      EXPECT_EQ(sequential.GetBinError(bin), parallel.GetBinError(bin));
+   }
+   list.Clear();
+}
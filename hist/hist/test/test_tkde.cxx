@@ -496,4 +496,42 @@ TEST(TKDE, tkde_io_mirror)
    for (size_t i = 0; i < t.xtest.size(); ++i) {
       EXPECT_NEAR(t.values1[i], t.values2[i], delta);
    }
-}
\ No newline at end of file
+}
+// compare the grid evaluation with the exact evaluation
+void CompareGridEvaluation(const char *iterationType, const char *mirrorType, int n)
+{
+   TRandom3 r(1111);
+   std::vector<double> data(n);
+   for (int i = 0; i < n; ++i)
+      data[i] = (r.Rndm() < 0.2) ? r.Gaus(10, 1) : r.Gaus(10, 7);
+   TString opt = TString::Format("KernelType:Gaussian;Iteration:%s;Mirror:%s;Binning:Unbinned", iterationType, mirrorType);
+   TKDE exact(n, data.data(), 0., 20., opt, 1);
+   TKDE grid(n, data.data(), 0., 20., opt, 1);
+   double tolerance = 1.E-4;
+   grid.SetEvaluation(TKDE::kGridEvaluation, tolerance);
+   double maxValue = 0;
+   std::vector<double> exactValues;
+   for (double x = -0.5; x < 20.5; x += 0.1) {
+      exactValues.push_back(exact(x));
+      maxValue = std::max(maxValue, exactValues.back());
+   }
+   int i = 0;
+   for (double x = -0.5; x < 20.5; x += 0.1, ++i) {
+      EXPECT_NEAR(grid(x), exactValues[i], 10 * tolerance * maxValue) << "x = " << x;
+   }
+}
+
+TEST(TKDE, tkde_grid)
+{
+   CompareGridEvaluation("Fixed", "noMirror", 20000);
+}
+
+TEST(TKDE, tkde_grid_adaptive)
+{
+   CompareGridEvaluation("Adaptive", "noMirror", 2000);
+}
+
+TEST(TKDE, tkde_grid_mirror)
+{
+   CompareGridEvaluation("Fixed", "mirrorAsymBoth", 20000);
+}
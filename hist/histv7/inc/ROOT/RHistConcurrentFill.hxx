@@ -31,6 +31,10 @@ class RHistConcurrentFillManager;
  \class RHistConcurrentFiller
  Buffers a thread's Fill calls and submits them to the
  RHistConcurrentFillManager. Enables multi-threaded filling.
+
+ If the histogram supports concurrent filling (see
+ RHistConcurrentFillManager::IsLockFree()), Fill() bypasses the buffer and
+ fills the histogram directly.
  **/
 
 template <class HIST, int SIZE>
@@ -44,7 +48,13 @@ public:
    RHistConcurrentFiller(RHistConcurrentFillManager<HIST, SIZE> &manager): fManager(manager) {}
 
    /// Thread-specific HIST::Fill().
-   using Internal::RHistBufferedFillBase<RHistConcurrentFiller<HIST, SIZE>, HIST, SIZE>::Fill;
+   void Fill(const CoordArray_t &x, Weight_t weight = 1.)
+   {
+      if constexpr (RHistConcurrentFillManager<HIST, SIZE>::IsLockFree())
+         fManager.fHist.Fill(x, weight);
+      else
+         Internal::RHistBufferedFillBase<RHistConcurrentFiller<HIST, SIZE>, HIST, SIZE>::Fill(x, weight);
+   }
 
    /// Thread-specific HIST::FillN().
    void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN)
@@ -71,6 +81,10 @@ private:
  buffer calls to Fill() until the buffer is full, and then swap the buffer
  with that of the RHistConcurrentFillManager. The manager than fills the
  histogram.
+
+ If all statistics of the histogram are updated atomically, for instance
+ with `RHist<2, double, RHistStatAtomicContent, RHistStatAtomicUncertainty>`,
+ the histogram is filled without taking a lock and without buffering.
  **/
 
 template <class HIST, int SIZE = 1024>
@@ -91,18 +105,30 @@ public:
 
    RHistConcurrentFiller<HIST, SIZE> MakeFiller() { return RHistConcurrentFiller<HIST, SIZE>{*this}; }
 
+   /// Whether the histogram can be filled concurrently without a lock, i.e.
+   /// whether all its statistics are updated atomically.
+   static constexpr bool IsLockFree() { return HIST::ImplBase_t::Stat_t::SupportsConcurrentFill(); }
+
    /// Thread-specific HIST::FillN().
    void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN)
    {
-      std::lock_guard<std::mutex> lockGuard(fFillMutex);
-      fHist.FillN(xN, weightN);
+      if constexpr (IsLockFree()) {
+         fHist.FillN(xN, weightN);
+      } else {
+         std::lock_guard<std::mutex> lockGuard(fFillMutex);
+         fHist.FillN(xN, weightN);
+      }
    }
 
    /// Thread-specific HIST::FillN().
    void FillN(const std::span<const CoordArray_t> xN)
    {
-      std::lock_guard<std::mutex> lockGuard(fFillMutex);
-      fHist.FillN(xN);
+      if constexpr (IsLockFree()) {
+         fHist.FillN(xN);
+      } else {
+         std::lock_guard<std::mutex> lockGuard(fFillMutex);
+         fHist.FillN(xN);
+      }
    }
 };
 
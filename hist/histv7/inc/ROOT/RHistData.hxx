@@ -71,10 +71,11 @@ public:
    using ConstBinStat_t = RConstBinStat;
    using BinStat_t = RBinStat;
 
-private:
+protected:
    /// Number of calls to Fill().
    int64_t fEntries = 0;
 
+private:
    /// Bin content.
    Content_t fBinContent;
 
@@ -371,6 +372,61 @@ public:
    }
 };
 
+/**
+ \class RHistStatAtomicContent
+ Like `RHistStatContent`, but `Fill()` updates the bin content and the number
+ of entries with atomic operations. Histograms using it (and otherwise only
+ statistics with atomic `Fill()`) can be filled from several threads at the
+ same time, without locking and without per-thread copies; see
+ `RHistConcurrentFillManager`. The content must only be read once the filling
+ threads are done.
+*/
+template <int DIMENSIONS, class PRECISION>
+class RHistStatAtomicContent: public RHistStatContent<DIMENSIONS, PRECISION> {
+public:
+   /// The type of a (possibly multi-dimensional) coordinate.
+   using CoordArray_t = Hist::CoordArray_t<DIMENSIONS>;
+   /// The type of the weight and the bin content.
+   using Weight_t = PRECISION;
+
+   using RHistStatContent<DIMENSIONS, PRECISION>::RHistStatContent;
+
+   /// `Fill()` can be called concurrently.
+   static constexpr bool SupportsConcurrentFill() { return true; }
+
+   /// Atomically add weight to the bin content at `binidx`.
+   void Fill(const CoordArray_t & /*x*/, int binidx, Weight_t weight = 1.)
+   {
+      Hist::AtomicAdd(this->GetBinArray(binidx), weight);
+      Hist::AtomicAdd(this->fEntries, int64_t(1));
+   }
+};
+
+/**
+ \class RHistStatAtomicUncertainty
+ Like `RHistStatUncertainty`, but `Fill()` updates the sum of squared weights
+ with atomic operations; see `RHistStatAtomicContent`.
+*/
+template <int DIMENSIONS, class PRECISION>
+class RHistStatAtomicUncertainty: public RHistStatUncertainty<DIMENSIONS, PRECISION> {
+public:
+   /// The type of a (possibly multi-dimensional) coordinate.
+   using CoordArray_t = Hist::CoordArray_t<DIMENSIONS>;
+   /// The type of the weight and the bin content.
+   using Weight_t = PRECISION;
+
+   using RHistStatUncertainty<DIMENSIONS, PRECISION>::RHistStatUncertainty;
+
+   /// `Fill()` can be called concurrently.
+   static constexpr bool SupportsConcurrentFill() { return true; }
+
+   /// Atomically add the squared weight to the bin at `binidx`.
+   void Fill(const CoordArray_t & /*x*/, int binidx, Weight_t weight = 1.)
+   {
+      Hist::AtomicAdd(this->GetBinArray(binidx), static_cast<Weight_t>(weight * weight));
+   }
+};
+
 /** \class RHistDataMomentUncert
   For now do as `RH1`: calculate first (xw) and second (x^2w) moment.
 */
@@ -516,6 +572,19 @@ private:
    template <class T>
    static char HaveUncertainty(...);
 
+   /// Check whether `T::Fill()` can be called concurrently, as announced by `T::SupportsConcurrentFill()`.
+   template <class T>
+   static constexpr auto HaveConcurrentFill(int) -> decltype(T::SupportsConcurrentFill())
+   {
+      return T::SupportsConcurrentFill();
+   }
+   /// Fall-back case for check whether `T::Fill()` can be called concurrently.
+   template <class T>
+   static constexpr bool HaveConcurrentFill(...)
+   {
+      return false;
+   }
+
 public:
    /// Matching `RHist`.
    using Hist_t = RHist<DIMENSIONS, PRECISION, STAT...>;
@@ -585,6 +654,13 @@ public:
       return sizeof(HaveUncertainty<AllYourBaseAreBelongToUs>(nullptr)) == sizeof(double);
    }
 
+   /// Whether `Fill()` can be called from several threads at the same time,
+   /// i.e. whether all statistics update their data atomically.
+   static constexpr bool SupportsConcurrentFill()
+   {
+      return (HaveConcurrentFill<STAT<DIMENSIONS, PRECISION>>(0) && ...);
+   }
+
    /// Calculate the bin content's uncertainty for the given bin, using base class information,
    /// i.e. forwarding to a base's `GetBinUncertaintyImpl(binidx)`.
    template <bool B = true, class = typename std::enable_if<B && HasBinUncertainty()>::type>
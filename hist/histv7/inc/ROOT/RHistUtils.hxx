@@ -16,6 +16,7 @@
 #define ROOT7_RHistUtils
 
 #include <array>
+#include <atomic>
 #include <type_traits>
 
 namespace ROOT {
@@ -57,6 +58,36 @@ template <int DIMENSIONS>
 //using CoordArray_t = std::array<double, DIMENSIONS>;
 using CoordArray_t = RCoordArray<DIMENSIONS>;
 
+/// Atomically add `value` to `target`, for integral and floating point types.
+///
+/// This allows plain `std::vector<PRECISION>` bin storage to be filled from
+/// several threads, see `RHistStatAtomicContent`. The memory order is relaxed:
+/// reading the result requires a synchronization with the filling threads,
+/// for instance by joining them.
+template <class T>
+void AtomicAdd(T &target, T value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   if constexpr (std::is_integral<T>::value) {
+      __atomic_fetch_add(&target, value, __ATOMIC_RELAXED);
+   } else {
+      T expected;
+      __atomic_load(&target, &expected, __ATOMIC_RELAXED);
+      T desired = expected + value;
+      // On failure, `expected` is updated to the current value of `target`.
+      while (!__atomic_compare_exchange(&target, &expected, &desired, /*weak=*/true, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED))
+         desired = expected + value;
+   }
+#else
+   static_assert(sizeof(std::atomic<T>) == sizeof(T) && alignof(std::atomic<T>) == alignof(T),
+                 "std::atomic<T> must have the layout of T");
+   auto &atomicTarget = *reinterpret_cast<std::atomic<T> *>(&target);
+   T expected = atomicTarget.load(std::memory_order_relaxed);
+   while (!atomicTarget.compare_exchange_weak(expected, static_cast<T>(expected + value), std::memory_order_relaxed)) {
+   }
+#endif
+}
 
 } // namespace Hist
 } // namespace Experimental
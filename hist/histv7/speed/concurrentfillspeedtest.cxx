@@ -0,0 +1,117 @@
+/// \file concurrentfillspeedtest.cxx
+///
+/// Compares multi-threaded filling of one histogram:
+///  - `RH1D` through `RHistConcurrentFillManager`: per-thread buffers, flushed under a lock;
+///  - an `RHist` with atomic statistics through `RHistConcurrentFillManager`: lock-free, unbuffered;
+///  - `TThreadedObject<TH1D>`: one histogram per thread, merged at the end.
+///
+/// Usage: `concurrentfillspeedtest [fills per thread] [number of threads] [number of bins]`
+///
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+#include "TH1.h"
+#include "TROOT.h"
+#include "ROOT/TThreadedObject.hxx"
+
+#include "ROOT/RHist.hxx"
+#include "ROOT/RHistConcurrentFill.hxx"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace ROOT;
+
+struct Timer {
+   using TimePoint_t = decltype(std::chrono::high_resolution_clock::now());
+
+   const char *fTitle;
+   size_t fCount;
+   TimePoint_t fStart;
+
+   Timer(const char *title, size_t count)
+      : fTitle(title), fCount(count), fStart(std::chrono::high_resolution_clock::now())
+   {}
+
+   ~Timer()
+   {
+      using namespace std::chrono;
+      auto end = high_resolution_clock::now();
+      duration<double> time_span = duration_cast<duration<double>>(end - fStart);
+      std::cout << fCount << " * " << fTitle << ": " << time_span.count() << " seconds, \t";
+      std::cout << fCount / (1e6) / time_span.count() << " millions per seconds \n";
+   }
+};
+
+using AtomicRH1D_t = Experimental::RHist<1, double, Experimental::RHistStatAtomicContent,
+                                         Experimental::RHistStatAtomicUncertainty>;
+
+/// Run `fill(thread index)` on `nThreads` threads.
+template <class FILL>
+void RunThreads(unsigned nThreads, FILL &&fill)
+{
+   std::vector<std::thread> threads;
+   for (unsigned t = 0; t < nThreads; ++t)
+      threads.emplace_back(fill, t);
+   for (auto &thr : threads)
+      thr.join();
+}
+
+/// Fill `HIST` from `nThreads` threads, `nFills` times each, through a `RHistConcurrentFillManager`.
+template <class HIST>
+double FillWithManager(const char *title, size_t nFills, unsigned nThreads, int nBins)
+{
+   HIST hist({nBins, 0., 1.});
+   {
+      Timer t(title, nFills * nThreads);
+      Experimental::RHistConcurrentFillManager<HIST> fillMgr(hist);
+      RunThreads(nThreads, [&](unsigned seed) {
+         auto filler = fillMgr.MakeFiller();
+         std::mt19937_64 gen(seed);
+         std::uniform_real_distribution<double> dist(0., 1.);
+         for (size_t i = 0; i < nFills; ++i)
+            filler.Fill({dist(gen)});
+      });
+   }
+   return hist.GetEntries();
+}
+
+/// Fill a `TThreadedObject<TH1D>` from `nThreads` threads, `nFills` times each, and merge it.
+double FillThreadedObject(size_t nFills, unsigned nThreads, int nBins)
+{
+   ROOT::TThreadedObject<TH1D> hist("h", "h", nBins, 0., 1.);
+   Timer t("TThreadedObject<TH1D> fill + merge", nFills * nThreads);
+   RunThreads(nThreads, [&](unsigned seed) {
+      auto h = hist.Get();
+      std::mt19937_64 gen(seed);
+      std::uniform_real_distribution<double> dist(0., 1.);
+      for (size_t i = 0; i < nFills; ++i)
+         h->Fill(dist(gen));
+   });
+   return hist.Merge()->GetEntries();
+}
+
+int main(int argc, char **argv)
+{
+   size_t nFills = 1e7;
+   unsigned nThreads = std::thread::hardware_concurrency();
+   int nBins = 1000;
+   if (argc > 1)
+      nFills = atof(argv[1]);
+   if (argc > 2)
+      nThreads = atoi(argv[2]);
+   if (argc > 3)
+      nBins = atoi(argv[3]);
+
+   ROOT::EnableThreadSafety();
+   TH1::AddDirectory(false);
+
+   std::cout << nThreads << " threads, " << nBins << " bins\n";
+   FillWithManager<Experimental::RH1D>("RH1D buffered + locked", nFills, nThreads, nBins);
+   FillWithManager<AtomicRH1D_t>("RH1D atomic, lock-free", nFills, nThreads, nBins);
+   FillThreadedObject(nFills, nThreads, nBins);
+}
@@ -2,8 +2,11 @@
 #include "ROOT/RHist.hxx"
 #include "ROOT/RHistConcurrentFill.hxx"
 
+#include <array>
+#include <cmath>
 #include <iostream>
 #include <future>
+#include <thread>
 
 using namespace ROOT;
 
@@ -143,3 +146,40 @@ TEST(ConcurrentFillTest, FillFlush)
    EXPECT_EQ(0, (int)Filler_1.GetCoords().size());
    EXPECT_EQ(0, (int)Filler_2.GetCoords().size());
 }
+
+using AtomicHist_t =
+   Experimental::RHist<2, double, Experimental::RHistStatAtomicContent, Experimental::RHistStatAtomicUncertainty>;
+
+static_assert(!Experimental::RHistConcurrentFillManager<Experimental::RH2D>::IsLockFree(),
+              "RH2D must be filled under a lock");
+static_assert(Experimental::RHistConcurrentFillManager<AtomicHist_t>::IsLockFree(),
+              "a histogram with atomic statistics must be filled without a lock");
+
+// Test lock-free filling of a histogram with atomic statistics
+TEST(ConcurrentFillTest, AtomicHistConsistency)
+{
+   AtomicHist_t hist{{100, 0., 1.}, {{0., 1., 2., 3., 10.}}};
+   Experimental::RHistConcurrentFillManager<AtomicHist_t> fillMgr(hist);
+
+   constexpr int kNThreads = 4;
+   constexpr int kNFills = 10000;
+   std::array<std::thread, kNThreads> threads;
+   for (auto &thr : threads) {
+      thr = std::thread([filler = fillMgr.MakeFiller()]() mutable {
+         for (int i = 0; i < kNFills; ++i) {
+            filler.Fill({0.4242, 4.2}, 0.5);
+            // Nothing is buffered, the histogram is filled directly.
+            EXPECT_EQ(0u, filler.GetCoords().size());
+         }
+         const std::array<AtomicHist_t::CoordArray_t, 2> xN{{{0.1111, 4.22}, {0.1111, 4.22}}};
+         filler.FillN(std::span<const AtomicHist_t::CoordArray_t>(xN.data(), xN.size()));
+      });
+   }
+   for (auto &thr : threads)
+      thr.join();
+
+   EXPECT_EQ(kNThreads * (kNFills + 2), hist.GetEntries());
+   EXPECT_DOUBLE_EQ(kNThreads * kNFills * 0.5, hist.GetBinContent({0.4242, 4.2}));
+   EXPECT_DOUBLE_EQ(kNThreads * 2., hist.GetBinContent({0.1111, 4.22}));
+   EXPECT_DOUBLE_EQ(std::sqrt(kNThreads * kNFills * 0.25), hist.GetBinUncertainty({0.4242, 4.2}));
+}
@@ -29,6 +29,7 @@ Classes used for fitting (regression analysis) and estimation of parameter value
 #include "Fit/FitResult.h"
 #include "Math/IParamFunction.h"
 #include <memory>
+#include <vector>
 
 namespace ROOT {
 
@@ -256,6 +257,20 @@ public:
       return DoLinearFit();
    }
 
+   /**
+      Fit many binned data sets with the same model function, for example one histogram per channel of a detector.
+      Each data set is fitted as with Fit (least square fit) or with LikelihoodFit (extended binned likelihood fit when
+      `likelihood` is true), starting from the parameter settings and with the options of the given configuration.
+      The data sets are not copied. The fits are distributed over the ROOT thread pool when the execution policy is
+      ROOT::EExecutionPolicy::kMultiThread, with the exception of the minimizers which are not thread safe
+      (Minuit, Fumili and Linear), and each worker reuses its minimizer from one fit to the next.
+      The results are returned in the order of the data sets. The minimizer is not kept in them, therefore
+      FitResult::Scan and FitResult::Contour cannot be used.
+   */
+   static std::vector<FitResult> FitBatch(const std::vector<std::shared_ptr<BinData>> &data, const IModelFunction &func,
+                                          const FitConfig &config, bool likelihood = false,
+                                          const ROOT::EExecutionPolicy &executionPolicy = ROOT::EExecutionPolicy::kSequential);
+
    /**
       Fit using the a generic FCN function as a C++ callable object implementing
       double () (const double *)
@@ -551,6 +566,8 @@ private:
 
    bool fUseGradient = false;  ///< flag to indicate if using gradient or not
 
+   bool fReuseMinimizer = false;  ///<! flag to reuse the minimizer of the previous fit (see FitBatch)
+
    bool fBinFit = false;    ///< flag to indicate if fit is binned
                             ///< in case of false the fit is unbinned or undefined)
                             ///< flag it is used to compute chi2 for binned likelihood fit
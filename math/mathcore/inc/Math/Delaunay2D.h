@@ -101,7 +101,11 @@ namespace ROOT {
 
    To speed up localisation of points (to see to which triangle belong) a grid is laid over the internal coordinate space.
    A reference to triangle ABC is added to _all_ grid cells that include ABC's bounding box.
-   The size of the grid is defined to be 25x25
+   The number of cells adapts to the number of triangles, such that each cell references only a few triangles.
+   The triangle indices of all cells are stored contiguously in one array.
+
+   Many points can be interpolated with a single call to Interpolate(n, x, y, z). When ROOT is built with
+   implicit multi-threading and it is enabled (ROOT::EnableImplicitMT()), the points are then interpolated in parallel.
 
    Optionally (if the compiler macro `HAS_GCAL` is defined ) the triangle findings and interpolation can be computed
    using the GCAL library. This is however not supported when using the class within ROOT
@@ -140,6 +144,10 @@ public:
    /// See the class documentation for  how the interpolation is computed.
    double  Interpolate(double x, double y);
 
+   /// Compute the interpolated z values corresponding to the n points (x[i],y[i]).
+   /// The points are interpolated in parallel if implicit multi-threading is enabled.
+   void  Interpolate(int n, const double *x, const double *y, double *z);
+
    /// Find all triangles
    void      FindAllTriangles();
 
@@ -180,7 +188,7 @@ private:
    void DoFindTriangles();
 
    /// internal method to compute the interpolation
-   double  DoInterpolateNormalized(double x, double y);
+   double  DoInterpolateNormalized(double x, double y) const;
 
 
 
@@ -223,10 +231,14 @@ protected:
    std::vector<double> fXN; ///<! normalized X
    std::vector<double> fYN; ///<! normalized Y
 
-   static const int fNCells = 25; ///<! number of cells to divide the normalized space
+   int fNCells = 0;   ///<! number of cells to divide each axis of the normalized space
    double fXCellStep; ///<! inverse denominator to calculate X cell = fNCells / (fXNmax - fXNmin)
    double fYCellStep; ///<! inverse denominator to calculate X cell = fNCells / (fYNmax - fYNmin)
-   std::set<unsigned int> fCells[(fNCells+1)*(fNCells+1)]; ///<! grid cells with containing triangles
+   std::vector<unsigned int> fCellStart;     ///<! index in fCellTriangles of the first triangle of each cell
+   std::vector<unsigned int> fCellTriangles; ///<! triangles overlapping each grid cell, stored cell after cell
+
+   /// build the grid of cells used to locate the triangles
+   void DoBuildCells();
 
    inline unsigned int Cell(unsigned int x, unsigned int y) const {
       return x*(fNCells+1) + y;
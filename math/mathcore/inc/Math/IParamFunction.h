@@ -130,6 +130,17 @@ namespace ROOT {
             return DoEval(x);
          }
 
+         /**
+            Evaluate function at n points for given parameters p.
+            The points are stored one after the other in x (n times NDim() values) and the function values are
+            stored in result. Use the virtual function DoEvalParBatch, which derived classes can re-implement to
+            evaluate the points more efficiently than one by one.
+         */
+         void EvalParBatch(unsigned int n, const T *x, const double *p, T *result) const
+         {
+            DoEvalParBatch(n, x, p, result);
+         }
+
       private:
          /**
             Implementation of the evaluation function using the x values and the parameters.
@@ -137,6 +148,16 @@ namespace ROOT {
          */
          virtual T DoEvalPar(const T *x, const double *p) const = 0;
 
+         /**
+            Implementation of the evaluation at many points. By default the points are evaluated one by one.
+         */
+         virtual void DoEvalParBatch(unsigned int n, const T *x, const double *p, T *result) const
+         {
+            const unsigned int ndim = this->NDim();
+            for (unsigned int i = 0; i < n; ++i)
+               result[i] = DoEvalPar(x + i * ndim, p);
+         }
+
          /**
             Implement the ROOT::Math::IBaseFunctionMultiDim interface DoEval(x) using the cached parameter values
          */
@@ -284,6 +284,8 @@ public:
    virtual double GlobalCC(unsigned int ivar) const;
 
    virtual bool GetMinosError(unsigned int ivar , double & errLow, double & errUp, int option = 0);
+   virtual bool GetMinosErrors(const std::vector<unsigned int> &ivars, std::vector<double> &errLow,
+                               std::vector<double> &errUp, std::vector<bool> &isValid, std::vector<int> &status);
    virtual bool Hesse();
    virtual bool Scan(unsigned int ivar , unsigned int & nstep , double * x , double * y ,
                      double xmin = 0, double xmax = 0);
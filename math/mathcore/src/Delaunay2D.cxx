@@ -13,6 +13,12 @@
 
 #include "Math/Delaunay2D.h"
 #include "Rtypes.h"
+#include "RConfigure.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
 
 //#include <thread>
 
@@ -22,6 +28,8 @@
 #endif
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdlib>
 
 #include <iostream>
@@ -131,6 +139,45 @@ double Delaunay2D::Interpolate(double x, double y)
    return zz;
 }
 
+//______________________________________________________________________________
+void Delaunay2D::Interpolate(int n, const double *x, const double *y, double *z)
+{
+   // Return the interpolated z values corresponding to the given (x,y) points
+
+   // Find the triangles before interpolating, such that the interpolation
+   // itself does not modify the object and can run in parallel.
+   FindAllTriangles();
+
+   if (fNdt == 0) {
+      std::fill(z, z + n, fZout);
+      return;
+   }
+
+   auto interpolateRange = [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+         double xx = Linear_transform(x[i], fOffsetX, fScaleFactorX);
+         double yy = Linear_transform(y[i], fOffsetY, fScaleFactorY);
+         z[i] = DoInterpolateNormalized(xx, yy);
+      }
+   };
+
+#ifdef R__USE_IMT
+   // below this number of points the overhead of the tasks is larger than the gain
+   constexpr int kMinPointsPerChunk = 1024;
+   if (ROOT::IsImplicitMTEnabled() && n >= 2 * kMinPointsPerChunk) {
+      const int nChunks = std::min<int>(n / kMinPointsPerChunk, 8 * ROOT::GetThreadPoolSize());
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](int chunk) {
+            interpolateRange(static_cast<Long64_t>(n) * chunk / nChunks, static_cast<Long64_t>(n) * (chunk + 1) / nChunks);
+         },
+         ROOT::TSeq<int>(0, nChunks));
+      return;
+   }
+#endif
+   interpolateRange(0, n);
+}
+
 //______________________________________________________________________________
 void Delaunay2D::FindAllTriangles()
 {
@@ -162,14 +209,15 @@ void Delaunay2D::FindAllTriangles()
 
 /// Triangle implementation for points normalization
 void Delaunay2D::DoNormalizePoints() {
+   fXN.clear();
+   fYN.clear();
+   fXN.reserve(fNpoints);
+   fYN.reserve(fNpoints);
    for (Int_t n = 0; n < fNpoints; n++) {
       fXN.push_back(Linear_transform(fX[n], fOffsetX, fScaleFactorX));
       fYN.push_back(Linear_transform(fY[n], fOffsetY, fScaleFactorY));
    }
 
-   //also initialize fXCellStep and FYCellStep
-   fXCellStep = fNCells / (fXNmax - fXNmin);
-   fYCellStep = fNCells / (fYNmax - fYNmin);
 }
 
 /// Triangle implementation for finding all the triangles
@@ -213,21 +261,53 @@ void Delaunay2D::DoFindTriangles() {
       tri.invDenom = 1 / ( (tri.y[1] - tri.y[2])*(tri.x[0] - tri.x[2]) + (tri.x[2] - tri.x[1])*(tri.y[0] - tri.y[2]) );
 
       fTriangles[i] = tri;
+   }
 
-      auto bx = std::minmax({tri.x[0], tri.x[1], tri.x[2]});
-      auto by = std::minmax({tri.y[0], tri.y[1], tri.y[2]});
+   DoBuildCells();
+}
 
-      unsigned int cellXmin = CellX(bx.first);
-      unsigned int cellXmax = CellX(bx.second);
+/// Build the grid of cells used to find the triangle containing a point.
+/// The number of cells is chosen such that there are about as many cells as triangles,
+/// and the triangles of all cells are stored in a single array (compressed row storage):
+/// the triangles overlapping cell c are fCellTriangles[fCellStart[c]] ... fCellTriangles[fCellStart[c+1]-1],
+/// in increasing order.
+void Delaunay2D::DoBuildCells() {
 
-      unsigned int cellYmin = CellY(by.first);
-      unsigned int cellYmax = CellY(by.second);
+   fNCells = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(fTriangles.size()))));
+   fXCellStep = fNCells / (fXNmax - fXNmin);
+   fYCellStep = fNCells / (fYNmax - fYNmin);
 
-      for(unsigned int j = cellXmin; j <= cellXmax; j++) {
-         for(unsigned int k = cellYmin; k <= cellYmax; k++) {
-            fCells[Cell(j,k)].insert(i);
-         }
-      }
+   const unsigned int nCells = (fNCells + 1) * (fNCells + 1);
+   const unsigned int nTriangles = fTriangles.size();
+
+   // range of cells overlapping the bounding box of a triangle
+   auto cellRange = [this](const Triangle &tri) {
+      auto bx = std::minmax({tri.x[0], tri.x[1], tri.x[2]});
+      auto by = std::minmax({tri.y[0], tri.y[1], tri.y[2]});
+      auto clamp = [this](int c) { return std::min(std::max(c, 0), fNCells); };
+      return std::array<int, 4>{{clamp(CellX(bx.first)), clamp(CellX(bx.second)), clamp(CellY(by.first)),
+                                 clamp(CellY(by.second))}};
+   };
+
+   // first pass: count the triangles of each cell
+   fCellStart.assign(nCells + 1, 0);
+   for (unsigned int i = 0; i < nTriangles; ++i) {
+      auto r = cellRange(fTriangles[i]);
+      for (int j = r[0]; j <= r[1]; ++j)
+         for (int k = r[2]; k <= r[3]; ++k)
+            ++fCellStart[Cell(j, k) + 1];
+   }
+   for (unsigned int c = 0; c < nCells; ++c)
+      fCellStart[c + 1] += fCellStart[c];
+
+   // second pass: store the triangle indices
+   fCellTriangles.resize(fCellStart[nCells]);
+   std::vector<unsigned int> next(fCellStart.begin(), fCellStart.end() - 1);
+   for (unsigned int i = 0; i < nTriangles; ++i) {
+      auto r = cellRange(fTriangles[i]);
+      for (int j = r[0]; j <= r[1]; ++j)
+         for (int k = r[2]; k <= r[3]; ++k)
+            fCellTriangles[next[Cell(j, k)]++] = i;
    }
 }
 
@@ -238,7 +318,7 @@ void Delaunay2D::DoFindTriangles() {
 /// Relay that all the triangles have been found before
 /// see comment in class description (in Delaunay2D.h) for implementation details:
 /// finding barycentric coordinates and computing the interpolation
-double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
+double Delaunay2D::DoInterpolateNormalized(double xx, double yy) const
 {
 
    // compute barycentric coordinates of a point P(xx,yy,zz)
@@ -269,8 +349,10 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
    if (cX < 0 || cX > fNCells || cY < 0 || cY > fNCells)
       return fZout; // TODO some more fancy interpolation here
 
-   for (unsigned int t : fCells[Cell(cX, cY)]) {
+   const unsigned int cell = Cell(cX, cY);
+   for (unsigned int it = fCellStart[cell]; it < fCellStart[cell + 1]; ++it) {
 
+      const unsigned int t = fCellTriangles[it];
       auto coords = bayCoords(t);
 
       // std::cout << "result of bayCoords " << std::get<0>(coords) <<
@@ -328,14 +410,12 @@ void Delaunay2D::DoFindTriangles() {
 }
 
 /// CGAL implementation for interpolation
-double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
+double Delaunay2D::DoInterpolateNormalized(double xx, double yy) const
 {
    // Finds the Delaunay triangle that the point (xi,yi) sits in (if any) and
    // calculate a z-value for it by linearly interpolating the z-values that
    // make up that triangle.
-
-   // initialise the Delaunay algorithm if needed
-    FindAllTriangles();
+   // The triangles have been found before, in Interpolate().
 
    //coordinate computation
    Point p(xx, yy);
@@ -213,6 +213,43 @@ namespace ROOT {
             }
          }
 
+         // number of points evaluated with a single call to IModelFunction::EvalParBatch
+         const unsigned int kEvalBatchSize = 1024;
+
+         // evaluate the model function for the points [begin, end) of the binned data with a single call to
+         // EvalParBatch. As for single points, the function is evaluated at the bin centers and multiplied
+         // by the bin volume when the bin volume is used
+         void EvaluateBinnedModel(const IModelFunction &func, const BinData &data, const double *p, unsigned int begin,
+                                  unsigned int end, bool useBinVolume, double wrefVolume, std::vector<double> &xc,
+                                  std::vector<double> &fval)
+         {
+            const unsigned int ndim = data.NDim();
+            const unsigned int n = end - begin;
+            fval.resize(n);
+            if (ndim == 1 && !useBinVolume) {
+               // the coordinates are contiguous
+               func.EvalParBatch(n, data.GetCoordComponent(begin, 0), p, fval.data());
+               return;
+            }
+            xc.resize(n * ndim);
+            std::vector<double> binVolume(useBinVolume ? n : 0, 1.0);
+            for (unsigned int j = 0; j < ndim; ++j) {
+               const double *x = data.GetCoordComponent(begin, j);
+               for (unsigned int i = 0; i < n; ++i) {
+                  if (useBinVolume) {
+                     double x2 = data.GetBinUpEdgeComponent(begin + i, j);
+                     binVolume[i] *= std::abs(x2 - x[i]);
+                     xc[i * ndim + j] = 0.5 * (x2 + x[i]);
+                  } else {
+                     xc[i * ndim + j] = x[i];
+                  }
+               }
+            }
+            func.EvalParBatch(n, xc.data(), p, fval.data());
+            for (unsigned int i = 0; i < binVolume.size(); ++i)
+               fval[i] *= binVolume[i] * wrefVolume;
+         }
+
 
 
       } // end namespace  FitUtil
@@ -276,17 +313,66 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
 
    (const_cast<IModelFunction &>(func)).SetParameters(p);
 
-   auto mapFunction = [&](const unsigned i){
+   // contribution of the point i, given the value fval of the model function
+   auto pointChi2 = [&](const unsigned i, double fval) {
 
       double chi2{};
-      double fval{};
 
-      const auto x1 = data.GetCoordComponent(i, 0);
       const auto y = data.Value(i);
       auto invError = data.InvError(i);
 
       //invError = (invError!= 0.0) ? 1.0/invError :1;
 
+      // expected errors
+      if (useExpErrors) {
+         double invWeight  = 1.0;
+         // case of weighted Pearson chi2 fit
+         if (isWeighted) {
+            // in case of requested a weighted Pearson fit (option "PW") a weight factor needs to be applied
+            // the bin inverse weight is estimated from bin error and bin content
+            if (y != 0)
+               invWeight = y * invError * invError;
+            else
+               // when y is 0 we use a global weight estimated form all histogram (correct if scaling the histogram)
+               // note that if the data is weighted data.SumOfError2 will not be equal to zero
+               invWeight = data.SumOfContent()/ data.SumOfError2();
+         }
+         // compute expected error  as f(x) or f(x) / weight (if weighted fit)
+         double invError2 = (fval > 0) ? invWeight / fval : 0.0;
+         invError = std::sqrt(invError2);
+         //std::cout << "using Pearson chi2 " << x[0] << "  " << 1./invError2 << "  " << fval << std::endl;
+      }
+
+#ifdef DEBUG
+      std::cout << *data.GetCoordComponent(i, 0) << "  " << y << "  " << 1./invError << " params : ";
+      for (unsigned int ipar = 0; ipar < func.NPar(); ++ipar)
+         std::cout << p[ipar] << "\t";
+      std::cout << "\tfval = " << fval << " ref " << wrefVolume << std::endl;
+#endif
+
+      if (invError > 0) {
+
+         double tmp = ( y -fval )* invError;
+         double resval = tmp * tmp;
+
+
+         // avoid infinity or nan in chi2 values due to wrong function values
+         if ( resval < maxResValue )
+            chi2 += resval;
+         else {
+            //nRejected++;
+            chi2 += maxResValue;
+         }
+      }
+      return chi2;
+  };
+
+   auto mapFunction = [&](const unsigned i){
+
+      double fval{};
+
+      const auto x1 = data.GetCoordComponent(i, 0);
+
       const double * x = nullptr;
       std::vector<double> xc;
       double binVolume = 1.0;
@@ -334,48 +420,7 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       // we need to multiply by the bin volume (e.g. for variable bins histograms)
       if (useBinVolume) fval *= binVolume;
 
-      // expected errors
-      if (useExpErrors) {
-         double invWeight  = 1.0;
-         // case of weighted Pearson chi2 fit
-         if (isWeighted) {
-            // in case of requested a weighted Pearson fit (option "PW") a weight factor needs to be applied
-            // the bin inverse weight is estimated from bin error and bin content
-            if (y != 0)
-               invWeight = y * invError * invError;
-            else
-               // when y is 0 we use a global weight estimated form all histogram (correct if scaling the histogram)
-               // note that if the data is weighted data.SumOfError2 will not be equal to zero
-               invWeight = data.SumOfContent()/ data.SumOfError2();
-         }
-         // compute expected error  as f(x) or f(x) / weight (if weighted fit)
-         double invError2 = (fval > 0) ? invWeight / fval : 0.0;
-         invError = std::sqrt(invError2);
-         //std::cout << "using Pearson chi2 " << x[0] << "  " << 1./invError2 << "  " << fval << std::endl;
-      }
-
-#ifdef DEBUG
-      std::cout << x[0] << "  " << y << "  " << 1./invError << " params : ";
-      for (unsigned int ipar = 0; ipar < func.NPar(); ++ipar)
-         std::cout << p[ipar] << "\t";
-      std::cout << "\tfval = " << fval << " bin volume " << binVolume << " ref " << wrefVolume << std::endl;
-#endif
-
-      if (invError > 0) {
-
-         double tmp = ( y -fval )* invError;
-         double resval = tmp * tmp;
-
-
-         // avoid infinity or nan in chi2 values due to wrong function values
-         if ( resval < maxResValue )
-            chi2 += resval;
-         else {
-            //nRejected++;
-            chi2 += maxResValue;
-         }
-      }
-      return chi2;
+      return pointChi2(i, fval);
   };
 
 #ifdef R__USE_IMT
@@ -394,7 +439,17 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
 #endif
 
   double res{};
-  if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
+  if(executionPolicy == ROOT::EExecutionPolicy::kSequential && !useBinIntegral){
+    // evaluate the function on blocks of points, which is faster for functions providing a batched evaluation
+    std::vector<double> xc;
+    std::vector<double> fval;
+    for (unsigned int begin = 0; begin < n; begin += kEvalBatchSize) {
+      const unsigned int end = std::min(n, begin + kEvalBatchSize);
+      EvaluateBinnedModel(func, data, p, begin, end, useBinVolume, wrefVolume, xc, fval);
+      for (unsigned int i = begin; i < end; ++i)
+        res += pointChi2(i, fval[i - begin]);
+    }
+  } else if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
     for (unsigned int i=0; i<n; ++i) {
       res += mapFunction(i);
     }
@@ -1493,9 +1548,59 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
    IntegralEvaluator<> igEval(func, p, useBinIntegral, igType);
 #endif
 
+   // contribution of the point i, given the value fval of the model function
+   auto pointNLL = [&](const unsigned i, double fval) {
+      auto y = *data.ValuePtr(i);
+
+      // EvalLog protects against 0 values of fval but don't want to add in the -log sum
+      // negative values of fval
+      fval = std::max(fval, 0.0);
+
+      double nloglike = 0; // negative loglikelihood
+      if (useW2) {
+         // apply weight correction . Effective weight is error^2/ y
+         // and expected events in bins is fval/weight
+         // can apply correction only when y is not zero otherwise weight is undefined
+         // (in case of weighted likelihood I don't care about the constant term due to
+         // the saturated model)
+
+         // use for the empty bins the global weight
+         double weight = 1.0;
+         if (y != 0) {
+            double error = data.Error(i);
+            weight = (error * error) / y; // this is the bin effective weight
+            nloglike -= weight * y * ( ROOT::Math::Util::EvalLog(fval/y) );
+         }
+         else {
+            // for empty bin use the average weight  computed from the total data weight
+            weight = data.SumOfError2()/ data.SumOfContent();
+         }
+         if (extended) {
+            nloglike += weight  *  ( fval - y);
+         }
+
+      } else {
+         // standard case no weights or iWeight=1
+         // this is needed for Poisson likelihood (which are extended and not for multinomial)
+         // the formula below  include constant term due to likelihood of saturated model (f(x) = y)
+         // (same formula as in Baker-Cousins paper, page 439 except a factor of 2
+         if (extended) nloglike = fval - y;
+
+         if (y >  0) {
+            nloglike += y * (ROOT::Math::Util::EvalLog(y) - ROOT::Math::Util::EvalLog(fval));
+         }
+      }
+#ifdef DEBUG
+      {
+         R__LOCKGUARD(gROOTMutex);
+         std::cout << " nll = " << nloglike << std::endl;
+      }
+#endif
+      return nloglike;
+   };
+
    auto mapFunction = [&](const unsigned i) {
       auto x1 = data.GetCoordComponent(i, 0);
-      auto y = *data.ValuePtr(i);
 
       const double *x = nullptr;
       std::vector<double> xc;
@@ -1540,8 +1645,6 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
       }
       if (useBinVolume) fval *= binVolume;
 
-
-
 #ifdef DEBUG
       int NSAMPLE = 100;
       if (i % NSAMPLE == 0) {
@@ -1553,56 +1656,11 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
             for (unsigned int j = 0; j < func.NDim(); ++j) std::cout << data.GetBinUpEdgeComponent(i, j) << " , ";
             std::cout << "] ";
          }
-         std::cout << "  y = " << y << " fval = " << fval << std::endl;
+         std::cout << "  y = " << *data.ValuePtr(i) << " fval = " << fval << std::endl;
       }
 #endif
 
-
-      // EvalLog protects against 0 values of fval but don't want to add in the -log sum
-      // negative values of fval
-      fval = std::max(fval, 0.0);
-
-      double nloglike = 0; // negative loglikelihood
-      if (useW2) {
-         // apply weight correction . Effective weight is error^2/ y
-         // and expected events in bins is fval/weight
-         // can apply correction only when y is not zero otherwise weight is undefined
-         // (in case of weighted likelihood I don't care about the constant term due to
-         // the saturated model)
-
-         // use for the empty bins the global weight
-         double weight = 1.0;
-         if (y != 0) {
-            double error = data.Error(i);
-            weight = (error * error) / y; // this is the bin effective weight
-            nloglike -= weight * y * ( ROOT::Math::Util::EvalLog(fval/y) );
-         }
-         else {
-            // for empty bin use the average weight  computed from the total data weight
-            weight = data.SumOfError2()/ data.SumOfContent();
-         }
-         if (extended) {
-            nloglike += weight  *  ( fval - y);
-         }
-
-      } else {
-         // standard case no weights or iWeight=1
-         // this is needed for Poisson likelihood (which are extended and not for multinomial)
-         // the formula below  include constant term due to likelihood of saturated model (f(x) = y)
-         // (same formula as in Baker-Cousins paper, page 439 except a factor of 2
-         if (extended) nloglike = fval - y;
-
-         if (y >  0) {
-            nloglike += y * (ROOT::Math::Util::EvalLog(y) - ROOT::Math::Util::EvalLog(fval));
-         }
-      }
-#ifdef DEBUG
-      {
-         R__LOCKGUARD(gROOTMutex);
-         std::cout << " nll = " << nloglike << std::endl;
-      }
-#endif
-      return nloglike;
+      return pointNLL(i, fval);
    };
 
 #ifdef R__USE_IMT
@@ -1621,7 +1679,17 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
 #endif
 
    double res{};
-   if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
+   if (executionPolicy == ROOT::EExecutionPolicy::kSequential && !useBinIntegral) {
+      // evaluate the function on blocks of points, which is faster for functions providing a batched evaluation
+      std::vector<double> xc;
+      std::vector<double> fval;
+      for (unsigned int begin = 0; begin < n; begin += kEvalBatchSize) {
+         const unsigned int end = std::min(n, begin + kEvalBatchSize);
+         EvaluateBinnedModel(func, data, p, begin, end, useBinVolume, wrefVolume, xc, fval);
+         for (unsigned int i = begin; i < end; ++i)
+            res += pointNLL(i, fval[i - begin]);
+      }
+   } else if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
       for (unsigned int i = 0; i < n; ++i) {
          res += mapFunction(i);
       }
@@ -26,7 +26,9 @@
 #include "Fit/FitResult.h"
 #include "Math/Error.h"
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 
 #include "Math/IParamFunction.h"
 
@@ -526,6 +528,71 @@ bool Fitter::DoLinearFit( ) {
    return ret;
 }
 
+std::vector<FitResult> Fitter::FitBatch(const std::vector<std::shared_ptr<BinData>> &data, const IModelFunction &func,
+                                        const FitConfig &config, bool likelihood,
+                                        const ROOT::EExecutionPolicy &executionPolicy)
+{
+   // fit each data set with the model function, reusing the fitter and its minimizer for consecutive data sets
+   std::vector<FitResult> results(data.size());
+
+   auto fitRange = [&](std::size_t begin, std::size_t end) {
+      Fitter fitter;
+      fitter.fConfig = config;
+      // all the fits start from the parameter settings of config
+      fitter.fConfig.SetUpdateAfterFit(false);
+      fitter.fReuseMinimizer = true;
+      for (std::size_t i = begin; i < end; ++i) {
+         if (!data[i]) {
+            MATH_ERROR_MSG("Fitter::FitBatch", "Data set is not valid");
+            continue;
+         }
+         // the function is cloned for each fit since the result keeps it
+         fitter.SetFunction(func);
+         // the parameter settings of config (limits, fixed parameters, ...) take precedence over the ones created
+         // from the function parameters
+         if (config.NPar() == func.NPar())
+            fitter.fConfig.SetParamsSettings(config.ParamsSettings());
+         fitter.SetData(data[i]);
+         fitter.fResult.reset();
+         if (likelihood)
+            fitter.DoBinnedLikelihoodFit(true);
+         else
+            fitter.DoLeastSquareFit();
+         if (fitter.fResult) {
+            results[i] = *fitter.fResult;
+            // the minimizer is used for the next fit
+            results[i].fMinimizer.reset();
+         }
+      }
+   };
+
+   const std::string &minimType = config.MinimizerType();
+   const bool threadSafeMinimizer = minimType != "Minuit" && minimType != "TMinuit" && minimType != "Fumili" &&
+                                    minimType != "TFumili" && minimType != "Linear";
+
+   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread && threadSafeMinimizer && data.size() > 1) {
+#ifdef R__USE_IMT
+      ROOT::TThreadExecutor pool;
+      // a few ranges per thread to balance fits of different durations
+      const std::size_t nRanges = std::min<std::size_t>(data.size(), 4 * pool.GetPoolSize());
+      pool.Foreach(
+         [&](std::size_t k) { fitRange(k * data.size() / nRanges, (k + 1) * data.size() / nRanges); },
+         ROOT::TSeq<std::size_t>(0, nRanges));
+      return results;
+#else
+      MATH_WARN_MSG("Fitter::FitBatch", "ROOT is built without IMT support: the fits are done sequentially");
+#endif
+   } else if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread && !threadSafeMinimizer) {
+      std::string msg = "The " + minimType + " minimizer is not thread safe: the fits are done sequentially";
+      MATH_WARN_MSG("Fitter::FitBatch", msg.c_str());
+   } else if (executionPolicy == ROOT::EExecutionPolicy::kMultiProcess) {
+      MATH_WARN_MSG("Fitter::FitBatch", "Multi-process execution is not supported: the fits are done sequentially");
+   }
+
+   fitRange(0, data.size());
+   return results;
+}
+
 
 bool Fitter::CalculateHessErrors() {
    // compute the Hesse errors according to configuration
@@ -623,29 +690,34 @@ bool Fitter::CalculateMinosErrors() {
    /// fConfig.SetMinosErrors(false);
 
 
-   const std::vector<unsigned int> & ipars = fConfig.MinosParams();
-   unsigned int n = (!ipars.empty()) ? ipars.size() : fResult->Parameters().size();
+   std::vector<unsigned int> ipars = fConfig.MinosParams();
+   if (ipars.empty()) {
+      ipars.resize(fResult->Parameters().size());
+      std::iota(ipars.begin(), ipars.end(), 0u);
+   }
    bool ok = false;
 
    int iparNewMin = 0;
-   int iparMax = n;
+   int iparMax = ipars.size();
    int iter = 0;
    // rerun minos for the parameters run before a new Minimum has been found
    do {
       if (iparNewMin > 0)
          MATH_INFO_MSG("Fitter::CalculateMinosErrors","Run again Minos for some parameters because a new Minimum has been found");
       iparNewMin = 0;
+      // the minimizer can compute the errors of all the parameters concurrently
+      const std::vector<unsigned int> indices(ipars.begin(), ipars.begin() + iparMax);
+      std::vector<double> elow, eup;
+      std::vector<bool> valid;
+      std::vector<int> status;
+      ok |= fMinimizer->GetMinosErrors(indices, elow, eup, valid, status);
       for (int i = 0; i < iparMax; ++i) {
-         double elow, eup;
-         unsigned int index = (!ipars.empty()) ? ipars[i] : i;
-         bool ret = fMinimizer->GetMinosError(index, elow, eup);
          // flags case when a new minimum has been found
-         if ((fMinimizer->MinosStatus() & 8) != 0) {
+         if ((status[i] & 8) != 0) {
             iparNewMin = i;
          }
-         if (ret)
-            fResult->SetMinosError(index, elow, eup);
-         ok |= ret;
+         if (valid[i])
+            fResult->SetMinosError(indices[i], elow[i], eup[i]);
       }
 
       iparMax = iparNewMin;
@@ -705,12 +777,18 @@ bool Fitter::DoInitMinimizer() {
       return false;
    }
 
-   // create first Minimizer
-   // using an auto_Ptr will delete the previous existing one
-   fMinimizer = std::shared_ptr<ROOT::Math::Minimizer> ( fConfig.CreateMinimizer() );
-   if (fMinimizer.get() == nullptr) {
-      MATH_ERROR_MSG("Fitter::DoInitMinimizer","Minimizer cannot be created");
-      return false;
+   if (fReuseMinimizer && fMinimizer) {
+      // reuse the minimizer of the previous fit, which avoids creating it through the plug-in manager
+      fMinimizer->Clear();
+      fMinimizer->SetOptions(fConfig.MinimizerOptions());
+   } else {
+      // create first Minimizer
+      // using an auto_Ptr will delete the previous existing one
+      fMinimizer = std::shared_ptr<ROOT::Math::Minimizer> ( fConfig.CreateMinimizer() );
+      if (fMinimizer.get() == nullptr) {
+         MATH_ERROR_MSG("Fitter::DoInitMinimizer","Minimizer cannot be created");
+         return false;
+      }
    }
 
    // in case of gradient function one needs to downcast the pointer
@@ -160,6 +160,30 @@ bool Minimizer::GetMinosError(unsigned int ivar, double &errLow, double &errUp,
    return false;
 }
 
+/**
+   minos errors for all the variables in ivars: the lower and upper errors of ivars[k] are returned in errLow[k] and
+   errUp[k], the value returned by GetMinosError in isValid[k] and the corresponding MinosStatus() in status[k].
+   The default implementation calls GetMinosError for each variable in turn. Minimizers which can compute the errors
+   of several variables concurrently re-implement it.
+   Return true if at least one of the errors is valid
+*/
+bool Minimizer::GetMinosErrors(const std::vector<unsigned int> &ivars, std::vector<double> &errLow,
+                               std::vector<double> &errUp, std::vector<bool> &isValid, std::vector<int> &status)
+{
+   const std::size_t n = ivars.size();
+   errLow.assign(n, 0.);
+   errUp.assign(n, 0.);
+   isValid.assign(n, false);
+   status.assign(n, -1);
+   bool ok = false;
+   for (std::size_t k = 0; k < n; ++k) {
+      isValid[k] = GetMinosError(ivars[k], errLow[k], errUp[k]);
+      status[k] = MinosStatus();
+      ok |= isValid[k];
+   }
+   return ok;
+}
+
 /**
    perform a full calculation of the Hessian matrix for error calculation
  */
@@ -0,0 +1,120 @@
+// Test and benchmark of ROOT::Fit::Fitter::FitBatch: fit many small histograms with the same model,
+// compared with a loop of TH1::Fit calls.
+// Usage: testFitBatch [number of histograms] [number of bins]
+
+#include "TH1.h"
+#include "TF1.h"
+#include "TRandom3.h"
+#include "TFitResult.h"
+#include "TError.h"
+#include "TROOT.h"
+#include "Fit/BinData.h"
+#include "Fit/FitConfig.h"
+#include "Fit/Fitter.h"
+#include "HFitInterface.h"
+#include "Math/MinimizerOptions.h"
+#include "Math/WrappedMultiTF1.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+const double tolerance = 1.E-4;
+
+// compare the minimum chi2 of each fit with the reference ones
+bool checkResults(const std::vector<ROOT::Fit::FitResult> &results, const std::vector<double> &refFcn,
+                  const std::string &name)
+{
+   for (std::size_t i = 0; i < results.size(); ++i) {
+      if (results[i].IsEmpty() || !results[i].IsValid()) {
+         Error("testFitBatch", "%s : fit of histogram %zu is not valid", name.c_str(), i);
+         return false;
+      }
+      if (std::abs(results[i].MinFcnValue() - refFcn[i]) > tolerance * std::max(1., std::abs(refFcn[i]))) {
+         Error("testFitBatch", "%s : histogram %zu has FCN = %f, it should be = %f", name.c_str(), i,
+               results[i].MinFcnValue(), refFcn[i]);
+         return false;
+      }
+   }
+   return true;
+}
+
+int main(int argc, char **argv)
+{
+   int nHist = 2000;
+   int nBins = 50;
+   if (argc > 1)
+      nHist = atoi(argv[1]);
+   if (argc > 2)
+      nBins = atoi(argv[2]);
+
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif
+   TH1::AddDirectory(false);
+   ROOT::Math::MinimizerOptions::SetDefaultMinimizer("Minuit2");
+
+   TF1 f("f", "gaus(0) + pol0(3)", -5, 5);
+   const double initPar[] = {50, 0, 1, 5};
+
+   // one histogram per channel, with a slightly different peak position and width
+   TRandom3 rndm(1);
+   std::vector<TH1D> hists;
+   hists.reserve(nHist);
+   for (int i = 0; i < nHist; ++i) {
+      hists.emplace_back(Form("h%d", i), "channel", nBins, -5, 5);
+      const double mean = rndm.Gaus(0, 0.3);
+      const double sigma = 1 + 0.1 * rndm.Rndm();
+      for (int j = 0; j < 2000; ++j)
+         hists.back().Fill(rndm.Gaus(mean, sigma));
+      for (int j = 0; j < 500; ++j)
+         hists.back().Fill(rndm.Uniform(-5, 5));
+   }
+
+   // reference: a loop of TH1::Fit
+   std::vector<double> refFcn(nHist);
+   auto start = std::chrono::steady_clock::now();
+   for (int i = 0; i < nHist; ++i) {
+      f.SetParameters(initPar);
+      auto res = hists[i].Fit(&f, "Q N S SERIAL");
+      refFcn[i] = res->MinFcnValue();
+   }
+   std::chrono::duration<double> refTime = std::chrono::steady_clock::now() - start;
+   std::cout << "Loop of TH1::Fit                 : " << refTime.count() << " s" << std::endl;
+
+   // the same fits with Fitter::FitBatch
+   f.SetParameters(initPar);
+   ROOT::Math::WrappedMultiTF1 func(f, 1);
+   std::vector<std::shared_ptr<ROOT::Fit::BinData>> data;
+   data.reserve(nHist);
+   ROOT::Fit::DataOptions opt;
+   ROOT::Fit::DataRange range(-5, 5);
+   for (auto &h : hists) {
+      data.push_back(std::make_shared<ROOT::Fit::BinData>(opt, range));
+      ROOT::Fit::FillData(*data.back(), &h, &f);
+   }
+   ROOT::Fit::FitConfig config;
+   config.SetParamsSettings(4, initPar);
+
+   bool ok = true;
+   start = std::chrono::steady_clock::now();
+   auto results = ROOT::Fit::Fitter::FitBatch(data, func, config);
+   std::chrono::duration<double> seqTime = std::chrono::steady_clock::now() - start;
+   std::cout << "Fitter::FitBatch, sequential     : " << seqTime.count() << " s, speedup "
+             << refTime.count() / seqTime.count() << std::endl;
+   ok &= checkResults(results, refFcn, "Sequential FitBatch");
+
+#ifdef R__USE_IMT
+   start = std::chrono::steady_clock::now();
+   results = ROOT::Fit::Fitter::FitBatch(data, func, config, false, ROOT::EExecutionPolicy::kMultiThread);
+   std::chrono::duration<double> mtTime = std::chrono::steady_clock::now() - start;
+   std::cout << "Fitter::FitBatch, multi-threaded : " << mtTime.count() << " s, speedup "
+             << refTime.count() / mtTime.count() << std::endl;
+   ok &= checkResults(results, refFcn, "Multithreaded FitBatch");
+#endif
+
+   return ok ? 0 : 1;
+}
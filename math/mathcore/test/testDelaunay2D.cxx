@@ -4,9 +4,13 @@
 
 
 #include "Math/Delaunay2D.h"
+#include "TRandom3.h"
 
 #include "gtest/gtest.h"
 
+#include <cmath>
+#include <vector>
+
 // test Delauney interpolation on edges of a triangle
 // some of these tests failed when using the older version
 // see issue #
@@ -62,3 +66,44 @@ TEST(Delaunay2D,interpolation_at_edges)
 }
 
 
+
+// test the interpolation of many points at once, on a plane where the
+// linear interpolation is exact
+TEST(Delaunay2D,interpolation_batch)
+{
+   const int n = 2000;
+   std::vector<double> x(n), y(n), z(n);
+   TRandom3 rnd(42);
+   for (int i = 0; i < n; ++i) {
+      x[i] = rnd.Uniform(-1, 1);
+      y[i] = rnd.Uniform(-1, 1);
+      z[i] = 2 * x[i] - 3 * y[i] + 1;
+   }
+   ROOT::Math::Delaunay2D d(n, x.data(), y.data(), z.data());
+   d.SetZOuterValue(-100.);
+
+   const int nx = 100;
+   std::vector<double> px, py;
+   for (int i = 0; i < nx; ++i) {
+      for (int j = 0; j < nx; ++j) {
+         px.push_back(-1.2 + 2.4 * (i + 0.5) / nx);
+         py.push_back(-1.2 + 2.4 * (j + 0.5) / nx);
+      }
+   }
+   std::vector<double> pz(px.size());
+   d.Interpolate(px.size(), px.data(), py.data(), pz.data());
+
+   int nInside = 0;
+   for (size_t i = 0; i < px.size(); ++i) {
+      EXPECT_DOUBLE_EQ(pz[i], d.Interpolate(px[i], py[i]));
+      if (pz[i] != -100.) {
+         ++nInside;
+         EXPECT_NEAR(pz[i], 2 * px[i] - 3 * py[i] + 1, 1.E-10);
+      }
+      // points outside the data range are outside the convex hull
+      if (std::abs(px[i]) > 1 || std::abs(py[i]) > 1) {
+         EXPECT_EQ(pz[i], -100.);
+      }
+   }
+   EXPECT_GT(nInside, 0.6 * px.size());
+}
@@ -104,6 +104,13 @@ public:
        Re-implement this function if needed.
    */
    virtual void SetErrorDef(double){};
+
+   /**
+       Return true if the function can be evaluated concurrently from several threads.
+       This allows Minuit to compute the numerical derivatives in parallel, when requested
+       with MnStrategy::SetParallelDerivatives. Re-implement this function if needed.
+   */
+   virtual bool IsThreadSafe() const { return false; }
 };
 
 } // namespace Minuit2
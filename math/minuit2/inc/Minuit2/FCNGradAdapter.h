@@ -120,9 +120,14 @@ public:
 
    void SetErrorDef(double up) override { fUp = up; }
 
+   bool IsThreadSafe() const override { return fThreadSafe; }
+   /// declare that the wrapped function can be evaluated concurrently
+   void SetThreadSafe(bool on) { fThreadSafe = on; }
+
 private:
    const Function &fFunc;
    double fUp;
+   bool fThreadSafe = false;
    mutable std::vector<double> fGrad;
    mutable std::vector<double> fHessian;
    mutable std::vector<double> fG2Vec;
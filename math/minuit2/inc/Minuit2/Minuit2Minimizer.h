@@ -16,6 +16,7 @@
 #include "Math/Minimizer.h"
 
 #include "Minuit2/MnUserParameterState.h"
+#include "Minuit2/MinosError.h"
 
 #include "Math/IFunctionfwd.h"
 
@@ -237,6 +238,15 @@ public:
    */
    bool GetMinosError(unsigned int i, double &errLow, double &errUp, int = 0) override;
 
+   /**
+      get the minos errors for all the parameters in ivars (see Minimizer::GetMinosErrors).
+      When the function is declared thread safe (extra option "ParallelDerivatives") and implicit
+      multi-threading is enabled, the lower and upper errors of all the parameters are computed concurrently.
+      The results are the same as calling GetMinosError for each parameter in turn
+   */
+   bool GetMinosErrors(const std::vector<unsigned int> &ivars, std::vector<double> &errLow,
+                       std::vector<double> &errUp, std::vector<bool> &isValid, std::vector<int> &status) override;
+
    /**
       MINOS status code of last Minos run
        `status & 1 > 0`  : invalid lower error
@@ -312,7 +322,7 @@ private:
    int fMinosStatus = -1; // Minos status code
 
    ROOT::Minuit2::MnUserParameterState fState;
-   // std::vector<ROOT::Minuit2::MinosError> fMinosErrors;
+   std::vector<ROOT::Minuit2::MinosError> fMinosErrors; // Minos errors computed in advance by GetMinosErrors
    ROOT::Minuit2::ModularFunctionMinimizer *fMinimizer;
    ROOT::Minuit2::FCNBase *fMinuitFCN;
    ROOT::Minuit2::FunctionMinimum *fMinimum;
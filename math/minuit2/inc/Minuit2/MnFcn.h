@@ -13,6 +13,8 @@
 #include "Minuit2/MnConfig.h"
 #include "Minuit2/MnMatrix.h"
 
+#include <atomic>
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -33,6 +35,8 @@ public:
    /// constructor of
    explicit MnFcn(const FCNBase &fcn, int ncall = 0) : fFCN(fcn), fNumCall(ncall) {}
 
+   MnFcn(const MnFcn &other) : fFCN(other.fFCN), fNumCall(other.fNumCall.load()) {}
+
    virtual ~MnFcn();
 
    virtual double operator()(const MnAlgebraicVector &) const;
@@ -50,7 +54,8 @@ private:
    const FCNBase &fFCN;
 
 protected:
-   mutable int fNumCall;
+   // atomic, since the numerical derivatives can call the function from several threads
+   mutable std::atomic<int> fNumCall;
 };
 
 } // namespace Minuit2
@@ -0,0 +1,46 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2024 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#ifndef ROOT_Minuit2_MnParallel
+#define ROOT_Minuit2_MnParallel
+
+#include <functional>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+class FCNBase;
+class MnStrategy;
+
+/**
+   Return true if independent computations evaluating fcn, like the Minos crossings, can
+   run in parallel: the FCN is thread safe (FCNBase::IsThreadSafe) and Minuit2 is built
+   within ROOT with implicit multi-threading enabled (ROOT::EnableImplicitMT). It is always
+   false when the OpenMP or MPI parallelization of Minuit2, or the non thread-safe stack
+   allocator, is compiled in.
+ */
+bool MnUseParallelTasks(const FCNBase &fcn);
+
+/**
+   Return true if the numerical derivatives of fcn should be computed in parallel:
+   the strategy requests it (MnStrategy::SetParallelDerivatives) and MnUseParallelTasks(fcn).
+ */
+bool MnUseParallelDerivatives(const MnStrategy &strategy, const FCNBase &fcn);
+
+/**
+   Call func(i) for i = 0, ..., n-1 on the ROOT thread pool, or sequentially when
+   implicit multi-threading is not available. The calls can happen in any order.
+ */
+void MnParallelFor(unsigned int n, const std::function<void(unsigned int)> &func);
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+#endif // ROOT_Minuit2_MnParallel
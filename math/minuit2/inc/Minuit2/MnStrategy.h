@@ -50,6 +50,9 @@ public:
 
    int StorageLevel() const { return fStoreLevel; }
 
+   // whether the numerical gradient and Hessian are computed in parallel (see MnParallel.h)
+   bool ParallelDerivatives() const { return fParallelDerivatives; }
+
    bool IsLow() const { return fStrategy == 0; }
    bool IsMedium() const { return fStrategy == 1; }
    bool IsHigh() const { return fStrategy == 2; }
@@ -81,6 +84,10 @@ public:
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
 
+   // compute the numerical gradient and Hessian in parallel on the ROOT thread pool,
+   // if implicit multi-threading is enabled and the FCN is thread safe (FCNBase::IsThreadSafe())
+   void SetParallelDerivatives(bool on) { fParallelDerivatives = on; }
+
 private:
    unsigned int fStrategy;
 
@@ -94,6 +101,7 @@ private:
    int fHessCFDG2;
    int fHessForcePosDef;
    int fStoreLevel;
+   bool fParallelDerivatives;
 };
 
 } // namespace Minuit2
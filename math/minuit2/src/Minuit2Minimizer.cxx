@@ -33,6 +33,7 @@
 #include "Minuit2/CombinedMinimizer.h"
 #include "Minuit2/ScanMinimizer.h"
 #include "Minuit2/FumiliMinimizer.h"
+#include "Minuit2/MnParallel.h"
 #include "Minuit2/MnParameterScan.h"
 #include "Minuit2/MnContours.h"
 #include "Minuit2/MnTraceObject.h"
@@ -444,10 +445,22 @@ ROOT::Minuit2::MnStrategy customizedStrategy(unsigned int strategyLevel, ROOT::M
    st.SetGradientStepTolerance(customize("GradientStepTolerance", st.GradientStepTolerance()));
    st.SetHessianStepTolerance(customize("HessianStepTolerance", st.HessianStepTolerance()));
    st.SetHessianG2Tolerance(customize("HessianG2Tolerance", st.HessianG2Tolerance()));
+   // the user declares that the function can be evaluated concurrently from several threads
+   st.SetParallelDerivatives(customize("ParallelDerivatives", int(st.ParallelDerivatives())) != 0);
 
    return st;
 }
 
+// declare whether the function wrapped by the FCN adapter can be evaluated concurrently
+void setFCNThreadSafe(ROOT::Minuit2::FCNBase *fcn, bool on)
+{
+   if (auto gradFcn = dynamic_cast<ROOT::Minuit2::FCNGradAdapter<ROOT::Math::IMultiGradFunction> *>(fcn)) {
+      gradFcn->SetThreadSafe(on);
+   } else if (auto genFcn = dynamic_cast<ROOT::Minuit2::FCNAdapter<ROOT::Math::IMultiGenFunction> *>(fcn)) {
+      genFcn->SetThreadSafe(on);
+   }
+}
+
 } // namespace
 
 bool Minuit2Minimizer::Minimize()
@@ -468,6 +481,7 @@ bool Minuit2Minimizer::Minimize()
    if (fMinimum)
       delete fMinimum;
    fMinimum = nullptr;
+   fMinosErrors.clear();
 
    const int maxfcn = MaxFunctionCalls();
    const double tol = Tolerance();
@@ -548,6 +562,7 @@ bool Minuit2Minimizer::Minimize()
    }
 
    const ROOT::Minuit2::MnStrategy strategy = customizedStrategy(strategyLevel, fOptions);
+   setFCNThreadSafe(fMinuitFCN, strategy.ParallelDerivatives());
 
    const ROOT::Minuit2::FCNGradientBase *gradFCN = dynamic_cast<const ROOT::Minuit2::FCNGradientBase *>(fMinuitFCN);
    if (gradFCN != nullptr) {
@@ -916,6 +931,50 @@ bool Minuit2Minimizer::GetMinosError(unsigned int i, double &errLow, double &err
    return isValid;
 }
 
+bool Minuit2Minimizer::GetMinosErrors(const std::vector<unsigned int> &ivars, std::vector<double> &errLow,
+                                      std::vector<double> &errUp, std::vector<bool> &isValid, std::vector<int> &status)
+{
+   // compute in advance the Minos crossings of all the parameters, concurrently, and then process them in turn
+   // with GetMinosError. When a new minimum is found the function is minimized again, which discards the
+   // crossings computed in advance, and the errors of the following parameters are computed from the new minimum
+
+   if (fMinuitFCN && fMinimum && fMinimum->IsValid() && ROOT::Minuit2::MnUseParallelTasks(*fMinuitFCN)) {
+      std::vector<unsigned int> pars;
+      for (unsigned int i : ivars) {
+         if (!fState.Parameter(i).IsConst() && !fState.Parameter(i).IsFixed() &&
+             std::find(pars.begin(), pars.end(), i) == pars.end())
+            pars.push_back(i);
+      }
+
+      fMinuitFCN->SetErrorDef(ErrorDef());
+      if (ErrorDef() != fMinimum->Up())
+         fMinimum->SetErrorDef(ErrorDef());
+
+      // switch off Minuit2 printing
+      const int prev_level = (PrintLevel() <= 0) ? TurnOffPrintInfoLevel() : -2;
+      const int prevGlobalLevel = MnPrint::SetGlobalLevel(PrintLevel());
+
+      if (Precision() > 0)
+         fState.SetPrecision(Precision());
+
+      MnPrint print("Minuit2Minimizer::GetMinosErrors", PrintLevel());
+      print.Info("Run MINOS for", pars.size(), "parameters in parallel");
+
+      ROOT::Minuit2::MnMinos minos(*fMinuitFCN, *fMinimum);
+      // same tolerance as in RunMinosError
+      fMinosErrors = minos.Minos(pars, MaxFunctionCalls(), std::max(Tolerance(), 0.01));
+
+      // restore global print level
+      if (prev_level > -2)
+         RestoreGlobalPrintLevel(prev_level);
+      MnPrint::SetGlobalLevel(prevGlobalLevel);
+   }
+
+   bool ok = Minimizer::GetMinosErrors(ivars, errLow, errUp, isValid, status);
+   fMinosErrors.clear();
+   return ok;
+}
+
 int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errUp, int runopt)
 {
 
@@ -953,7 +1012,12 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
       maxfcn_used = 2 * (nvar + 1) * (200 + 100 * nvar + 5 * nvar * nvar);
    }
 
-   if (runLower) {
+   // use the errors computed in advance by GetMinosErrors, if any
+   auto precomputed = std::find_if(fMinosErrors.begin(), fMinosErrors.end(),
+                                   [i](const ROOT::Minuit2::MinosError &err) { return err.Parameter() == i; });
+   const bool usePrecomputed = runLower && runUpper && precomputed != fMinosErrors.end();
+
+   if (runLower && !usePrecomputed) {
       if (debugLevel >= 1) {
          std::cout << "************************************************************************************************"
                       "******\n";
@@ -962,7 +1026,7 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
       }
       low = minos.Loval(i, maxfcn, tol);
    }
-   if (runUpper) {
+   if (runUpper && !usePrecomputed) {
       if (debugLevel >= 1) {
          std::cout << "************************************************************************************************"
                       "******\n";
@@ -972,7 +1036,8 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
       up = minos.Upval(i, maxfcn, tol);
    }
 
-   ROOT::Minuit2::MinosError me(i, fMinimum->UserState().Value(i), low, up);
+   const ROOT::Minuit2::MinosError me =
+      usePrecomputed ? *precomputed : ROOT::Minuit2::MinosError(i, fMinimum->UserState().Value(i), low, up);
 
    // restore global print level
    if (prev_level > -2)
@@ -1072,11 +1137,11 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
    // in case of new minimum found update also the  minimum state
    if ((runLower && me.LowerNewMin()) && (runUpper && me.UpperNewMin())) {
       // take state with lower function value
-      fState = (low.State().Fval() < up.State().Fval()) ? low.State() : up.State();
+      fState = (me.LowerState().Fval() < me.UpperState().Fval()) ? me.LowerState() : me.UpperState();
    } else if (runLower && me.LowerNewMin()) {
-      fState = low.State();
+      fState = me.LowerState();
    } else if (runUpper && me.UpperNewMin()) {
-      fState = up.State();
+      fState = me.UpperState();
    }
 
    return mstatus;
@@ -1222,7 +1287,9 @@ bool Minuit2Minimizer::Hesse()
    if (Precision() > 0)
       fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnHesse hesse(customizedStrategy(Strategy(), fOptions));
+   const ROOT::Minuit2::MnStrategy strategy = customizedStrategy(Strategy(), fOptions);
+   setFCNThreadSafe(fMinuitFCN, strategy.ParallelDerivatives());
+   ROOT::Minuit2::MnHesse hesse(strategy);
 
    // case when function minimum exists
    if (fMinimum) {
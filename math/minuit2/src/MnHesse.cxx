@@ -23,6 +23,9 @@
 #include "Minuit2/FunctionMinimum.h"
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MPIProcess.h"
+#include "Minuit2/MnParallel.h"
+
+#include <vector>
 
 namespace ROOT {
 
@@ -228,15 +231,17 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    print.Debug("Gradient is", st.Gradient().IsAnalytical() ? "analytical" : "numerical", "\n  point:", x,
                "\n  fcn  :", amin, "\n  grad :", grd, "\n  step :", gst, "\n  g2   :", g2);
 
-   for (unsigned int i = 0; i < n; i++) {
-
+   // compute the second derivative with respect to parameter i; the function is evaluated at points
+   // differing from x only in the coordinate i, which is restored at the end.
+   // Return false if the second derivative is zero.
+   auto computeDiagonal = [&](unsigned int i, MnAlgebraicVector &x, MnPrint &prt) -> bool {
       double xtf = x(i);
       double dmin = 8. * prec.Eps2() * (std::fabs(xtf) + prec.Eps2());
       double d = std::fabs(gst(i));
       if (d < dmin)
          d = dmin;
 
-      print.Debug("Derivative parameter", i, "d =", d, "dmin =", dmin);
+      prt.Debug("Derivative parameter", i, "d =", d, "dmin =", dmin);
 
       for (unsigned int icyc = 0; icyc < Ncycles(); icyc++) {
          double sag = 0.;
@@ -250,14 +255,14 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
             x(i) = xtf;
             sag = 0.5 * (fs1 + fs2 - 2. * amin);
 
-            print.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
+            prt.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
 
             //  Now as F77 Minuit - check that sag is not zero
             if (sag != 0)
                goto L30; // break
             if (trafo.Parameter(i).HasLimits()) {
                if (d > 0.5)
-                  goto L26;
+                  return false;
                d *= 10.;
                if (d > 0.5)
                   d = 0.51;
@@ -266,19 +271,7 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
             d *= 10.;
          }
 
-      L26:
-         // get parameter name for i
-         // (need separate scope for avoiding compl error when declaring name)
-         print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
-                    "; MnHesse fails and will return diagonal matrix");
-
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
-
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
-                             mfcn.NumOfCalls());
+         return false;
 
       L30:
          double g2bfor = g2(i);
@@ -294,8 +287,8 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          if (d < dmin)
             d = dmin;
 
-         print.Debug("g1 =", grd(i), "g2 =", g2(i), "step =", gst(i), "d =", d, "diffd =", std::fabs(d - dlast) / d,
-                     "diffg2 =", std::fabs(g2(i) - g2bfor) / g2(i));
+         prt.Debug("g1 =", grd(i), "g2 =", g2(i), "step =", gst(i), "d =", d, "diffd =", std::fabs(d - dlast) / d,
+                   "diffg2 =", std::fabs(g2(i) - g2bfor) / g2(i));
 
          // see if converged
          if (std::fabs((d - dlast) / d) < Tolerstp())
@@ -305,19 +298,62 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          d = std::min(d, 10. * dlast);
          d = std::max(d, 0.1 * dlast);
       }
-      vhmat(i, i) = g2(i);
-      if (mfcn.NumOfCalls() > maxcalls) {
+      return true;
+   };
 
-         // std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
-         print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
+   // return a diagonal matrix when the second derivative of parameter i is zero
+   auto diagonalZero = [&](unsigned int i) {
+      // get parameter name for i
+      print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
+                 "; MnHesse fails and will return diagonal matrix");
 
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
+      for (unsigned int j = 0; j < n; j++) {
+         double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
+         vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+      }
+
+      return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
+                          mfcn.NumOfCalls());
+   };
+
+   // return a diagonal matrix when the maximum number of calls is exceeded
+   auto callLimitReached = [&]() {
+      // std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
+      print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
+
+      for (unsigned int j = 0; j < n; j++) {
+         double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
+         vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+      }
 
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnReachedCallLimit), st.Gradient(),
-                             st.Edm(), mfcn.NumOfCalls());
+      return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnReachedCallLimit), st.Gradient(),
+                          st.Edm(), mfcn.NumOfCalls());
+   };
+
+   const bool parallel = MnUseParallelDerivatives(fStrategy, mfcn.Fcn());
+
+   if (parallel) {
+      // all the diagonal elements are computed concurrently, the call limit is checked at the end
+      std::vector<char> ok(n);
+      MnParallelFor(n, [&](unsigned int i) {
+         MnPrint printtl("MnHesse[IMT]", print.Level());
+         MnAlgebraicVector xl = x;
+         ok[i] = computeDiagonal(i, xl, printtl);
+      });
+      for (unsigned int i = 0; i < n; i++) {
+         if (!ok[i])
+            return diagonalZero(i);
+         vhmat(i, i) = g2(i);
+      }
+      if (mfcn.NumOfCalls() > maxcalls)
+         return callLimitReached();
+   } else {
+      for (unsigned int i = 0; i < n; i++) {
+         if (!computeDiagonal(i, x, print))
+            return diagonalZero(i);
+         vhmat(i, i) = g2(i);
+         if (mfcn.NumOfCalls() > maxcalls)
+            return callLimitReached();
       }
    }
 
@@ -335,7 +371,37 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    // off-diagonal Elements
    // initial starting values
    bool doCentralFD = fStrategy.HessianCentralFDMixedDerivatives();
-   if (n > 0) {
+   if (n > 0 && parallel) {
+      // each element (i, j) with i < j is an independent task
+      MnParallelFor(n * (n - 1) / 2, [&](unsigned int in) {
+         unsigned int i = 0;
+         unsigned int rowStart = 0;
+         while (in >= rowStart + (n - 1 - i)) {
+            rowStart += n - 1 - i;
+            ++i;
+         }
+         unsigned int j = i + 1 + (in - rowStart);
+
+         MnAlgebraicVector xl = x;
+         const double xi = x(i);
+         const double xj = x(j);
+         xl(i) = xi + dirin(i);
+         xl(j) = xj + dirin(j);
+         double fs1 = mfcn(xl);
+         if (!doCentralFD) {
+            vhmat(i, j) = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+         } else {
+            // three more function evaluations required for central fd
+            xl(i) = xi - dirin(i);
+            double fs3 = mfcn(xl);
+            xl(j) = xj - dirin(j);
+            double fs4 = mfcn(xl);
+            xl(i) = xi + dirin(i);
+            double fs2 = mfcn(xl);
+            vhmat(i, j) = (fs1 - fs2 - fs3 + fs4) / (4. * dirin(i) * dirin(j));
+         }
+      });
+   } else if (n > 0) {
       MPIProcess mpiprocOffDiagonal(n * (n - 1) / 2, 0);
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
       unsigned int endParIndexOffDiagonal = mpiprocOffDiagonal.EndElementIndex();
@@ -14,6 +14,7 @@
 #include "Minuit2/MnCross.h"
 #include "Minuit2/MinosError.h"
 #include "Minuit2/MnPrint.h"
+#include "Minuit2/MnParallel.h"
 
 namespace ROOT {
 
@@ -91,6 +92,32 @@ MinosError MnMinos::Minos(unsigned int par, unsigned int maxcalls, double toler)
    return MinosError(par, fMinimum.UserState().Value(par), lo, up);
 }
 
+std::vector<MinosError>
+MnMinos::Minos(const std::vector<unsigned int> &pars, unsigned int maxcalls, double toler) const
+{
+   // do full minos error analysis for all the parameters in pars.
+   // The crossings 2 * k and 2 * k + 1 are the lower and upper ones of pars[k]: they all start from
+   // the same minimum and are independent, so they can be computed in parallel
+
+   std::vector<MnCross> crossings(2 * pars.size());
+   auto findCross = [&](unsigned int icross) {
+      crossings[icross] = FindCrossValue(icross % 2 == 0 ? -1 : 1, pars[icross / 2], maxcalls, toler);
+   };
+
+   if (MnUseParallelTasks(fFCN)) {
+      MnParallelFor(crossings.size(), findCross);
+   } else {
+      for (unsigned int icross = 0; icross < crossings.size(); ++icross)
+         findCross(icross);
+   }
+
+   std::vector<MinosError> errors;
+   errors.reserve(pars.size());
+   for (unsigned int k = 0; k < pars.size(); ++k)
+      errors.emplace_back(pars[k], fMinimum.UserState().Value(pars[k]), crossings[2 * k], crossings[2 * k + 1]);
+   return errors;
+}
+
 MnCross MnMinos::FindCrossValue(int direction, unsigned int par, unsigned int maxcalls, double toler) const
 {
    // get crossing value in the parameter direction :
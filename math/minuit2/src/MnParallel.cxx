@@ -0,0 +1,59 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2024 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#include "Minuit2/MnParallel.h"
+#include "Minuit2/FCNBase.h"
+#include "Minuit2/MnStrategy.h"
+#include "Minuit2/StackAllocator.h"
+
+// the ROOT thread pool is only available when building within ROOT
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h"
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#define MINUIT2_USE_IMT
+#endif
+#endif
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+bool MnUseParallelTasks(const FCNBase &fcn)
+{
+#if defined(MINUIT2_USE_IMT) && !defined(_OPENMP) && !defined(MPIPROC) && !defined(_MN_NO_THREAD_SAVE_)
+   return fcn.IsThreadSafe() && ROOT::IsImplicitMTEnabled();
+#else
+   (void)fcn;
+   return false;
+#endif
+}
+
+bool MnUseParallelDerivatives(const MnStrategy &strategy, const FCNBase &fcn)
+{
+   return strategy.ParallelDerivatives() && MnUseParallelTasks(fcn);
+}
+
+void MnParallelFor(unsigned int n, const std::function<void(unsigned int)> &func)
+{
+#ifdef MINUIT2_USE_IMT
+   if (n > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(func, ROOT::TSeq<unsigned int>(0, n));
+      return;
+   }
+#endif
+   for (unsigned int i = 0; i < n; ++i)
+      func(i);
+}
+
+} // namespace Minuit2
+
+} // namespace ROOT
@@ -16,6 +16,7 @@
 #include "Minuit2/FunctionGradient.h"
 #include "Minuit2/MnStrategy.h"
 #include "Minuit2/MnPrint.h"
+#include "Minuit2/MnParallel.h"
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -97,35 +98,9 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around function value", fcnmin, "\n\t at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // compute the derivative with respect to parameter i; the function is evaluated at points
+   // differing from x only in the coordinate i, which is restored at the end
+   auto computeDerivative = [&](unsigned int i, MnAlgebraicVector &x, MnPrint &prt) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
@@ -173,26 +148,14 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 #pragma omp critical
 #endif
          {
-#ifdef _OPENMP
-            // must create thread-local MnPrint instances when printing inside threads
-            MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
-#endif
             if (i == 0 && j == 0) {
-#ifdef _OPENMP
-               printtl.Trace([&](std::ostream &os) {
-#else
-               print.Trace([&](std::ostream &os) {
-#endif
+               prt.Trace([&](std::ostream &os) {
                   os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x" << std::setw(15)
                      << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15) << "grd"
                      << std::setw(15) << "g2" << std::endl;
                });
             }
-#ifdef _OPENMP
-            printtl.Trace([&](std::ostream &os) {
-#else
-            print.Trace([&](std::ostream &os) {
-#endif
+            prt.Trace([&](std::ostream &os) {
                const int pr = os.precision(13);
                const int iext = Trafo().ExtOfInt(i);
                os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
@@ -209,17 +172,55 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
             break;
          }
       }
+   };
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
-   }
+   if (MnUseParallelDerivatives(Strategy(), Fcn().Fcn())) {
+
+      // parallelize over the parameters using the ROOT thread pool
+      MnParallelFor(n, [&](unsigned int i) {
+         // each task uses its own copy of the parameters and a thread-local MnPrint instance
+         MnPrint printtl("Numerical2PGradientCalculator[IMT]", print.Level());
+         MnAlgebraicVector x = par.Vec();
+         computeDerivative(i, x, printtl);
+      });
+
+   } else {
 
 #ifndef _OPENMP
-   mpiproc.SyncVector(grd);
-   mpiproc.SyncVector(g2);
-   mpiproc.SyncVector(gstep);
+
+      MPIProcess mpiproc(n, 0);
+
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+
+      unsigned int startElementIndex = mpiproc.StartElementIndex();
+      unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++)
+         computeDerivative(i, x, print);
+
+      mpiproc.SyncVector(grd);
+      mpiproc.SyncVector(g2);
+      mpiproc.SyncVector(gstep);
+
+#else
+
+      // parallelize this loop using OpenMP
+//#define N_PARALLEL_PAR 5
+#pragma omp parallel
+#pragma omp for
+      //#pragma omp for schedule (static, N_PARALLEL_PAR)
+
+      for (int i = 0; i < int(n); i++) {
+         // create in loop since each thread will use its own copy
+         MnAlgebraicVector x = par.Vec();
+         // must create thread-local MnPrint instances when printing inside threads
+         MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
+         computeDerivative(i, x, printtl);
+      }
+
 #endif
+   }
 
    // print after parallel processing to avoid synchronization issues
    print.Debug([&](std::ostream &os) {
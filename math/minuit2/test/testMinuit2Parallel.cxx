@@ -0,0 +1,227 @@
+// Tests of the parallel computations in Minuit2, which must give the same results as the sequential ones
+
+#include "Minuit2/FCNBase.h"
+#include "Minuit2/FunctionMinimum.h"
+#include "Minuit2/Minuit2Minimizer.h"
+#include "Minuit2/MnHesse.h"
+#include "Minuit2/MnMigrad.h"
+#include "Minuit2/MnParallel.h"
+#include "Minuit2/MnStrategy.h"
+#include "Minuit2/MnUserParameters.h"
+#include "Math/Functor.h"
+#include "Math/GenAlgoOptions.h"
+
+#include "RConfigure.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr unsigned int kNPar = 5;
+
+// A function of correlated parameters with asymmetric errors. It has no state, so it can be evaluated
+// concurrently from several threads. The last parameter is fixed in the tests.
+double TestFunction(const double *x)
+{
+   const double d0 = x[0] - 1.;
+   const double d1 = x[1] + 2.;
+   const double d3 = (x[3] - 0.5) / 0.5;
+   return d0 * d0 + 2. * d1 * d1 + 0.6 * d0 * d1 + 0.5 * d0 * d0 * d1 * d1 + 4. * (std::exp(x[2]) - 1. - x[2]) +
+          d3 * d3 + 0.2 * d3 * d3 * d3 * d3 + x[4] * x[4] * d0 * d0;
+}
+
+// TestFunction as a Minuit2 FCN declared thread safe
+class ThreadSafeFcn : public ROOT::Minuit2::FCNBase {
+public:
+   double operator()(const std::vector<double> &x) const override { return TestFunction(x.data()); }
+   double Up() const override { return 1.; }
+   bool IsThreadSafe() const override { return true; }
+};
+
+// Set up a minimizer of TestFunction. If threadSafe is true, the function is declared thread safe and the
+// numerical derivatives are computed in parallel when implicit multi-threading is enabled.
+void SetupMinimizer(ROOT::Minuit2::Minuit2Minimizer &minimizer, bool threadSafe)
+{
+   ROOT::Math::Functor func(&TestFunction, kNPar);
+   minimizer.SetFunction(func);
+   minimizer.SetVariable(0, "x0", 0., 0.1);
+   minimizer.SetVariable(1, "x1", 0., 0.1);
+   minimizer.SetVariable(2, "x2", 0.5, 0.1);
+   minimizer.SetVariable(3, "x3", 0., 0.1);
+   minimizer.SetFixedVariable(4, "x4", 0.1);
+   minimizer.SetStrategy(1);
+   minimizer.SetPrintLevel(0);
+   ROOT::Math::GenAlgoOptions options;
+   options.SetValue("ParallelDerivatives", threadSafe ? 1 : 0);
+   minimizer.SetExtraOptions(options);
+}
+
+// The parallel off-diagonal Hessian elements are computed from the same points as the sequential ones, but the
+// sequential loop moves the parameters back and forth, which can change their last bits
+void ExpectClose(double val, double ref, const std::string &what)
+{
+   EXPECT_NEAR(val, ref, 1e-8 * std::max(1., std::abs(ref))) << what;
+}
+
+// Enable implicit multi-threading in the scope of the object, if requested
+class ImplicitMTGuard {
+public:
+   ImplicitMTGuard(bool enable) : fEnabled(enable)
+   {
+#ifdef R__USE_IMT
+      if (fEnabled)
+         ROOT::EnableImplicitMT(4);
+#endif
+   }
+   ~ImplicitMTGuard()
+   {
+#ifdef R__USE_IMT
+      if (fEnabled)
+         ROOT::DisableImplicitMT();
+#endif
+   }
+
+private:
+   bool fEnabled;
+};
+
+} // namespace
+
+// The Minos errors of several parameters computed together must be the same as the ones of the single parameters
+TEST(Minuit2Parallel, MinosErrors)
+{
+   for (bool imt : {false, true}) {
+      SCOPED_TRACE(imt ? "implicit MT, thread safe function" : "sequential");
+      ImplicitMTGuard imtGuard(imt);
+
+      ROOT::Minuit2::Minuit2Minimizer ref;
+      ROOT::Minuit2::Minuit2Minimizer batched;
+      SetupMinimizer(ref, imt);
+      SetupMinimizer(batched, imt);
+      ASSERT_TRUE(ref.Minimize());
+      ASSERT_TRUE(batched.Minimize());
+
+      // the fixed parameter has no valid Minos error
+      const std::vector<unsigned int> pars{0, 1, 2, 3, 4};
+      std::vector<double> errLow;
+      std::vector<double> errUp;
+      std::vector<bool> isValid;
+      std::vector<int> status;
+      EXPECT_TRUE(batched.GetMinosErrors(pars, errLow, errUp, isValid, status));
+      ASSERT_EQ(errLow.size(), pars.size());
+      ASSERT_EQ(errUp.size(), pars.size());
+      ASSERT_EQ(isValid.size(), pars.size());
+      ASSERT_EQ(status.size(), pars.size());
+
+      for (std::size_t k = 0; k < pars.size(); ++k) {
+         SCOPED_TRACE("parameter " + std::to_string(pars[k]));
+         double refLow = 0.;
+         double refUp = 0.;
+         const bool refValid = ref.GetMinosError(pars[k], refLow, refUp);
+         EXPECT_EQ(isValid[k], refValid);
+         EXPECT_EQ(status[k], ref.MinosStatus());
+         EXPECT_DOUBLE_EQ(errLow[k], refLow);
+         EXPECT_DOUBLE_EQ(errUp[k], refUp);
+         EXPECT_EQ(pars[k] != 4, refValid);
+      }
+
+      // the error of x2 is asymmetric
+      EXPECT_GT(std::abs(errUp[2] + errLow[2]), 0.01);
+   }
+}
+
+// The numerical gradient and Hessian computed in parallel must be the same as the sequential ones
+TEST(Minuit2Parallel, ParallelDerivatives)
+{
+   using namespace ROOT::Minuit2;
+
+   ImplicitMTGuard imtGuard(true);
+
+   ThreadSafeFcn fcn;
+   MnUserParameters upar;
+   upar.Add("x0", 0., 0.1);
+   upar.Add("x1", 0., 0.1);
+   upar.Add("x2", 0.5, 0.1);
+   upar.Add("x3", 0., 0.1);
+   upar.Add("x4", 0.1, 0.1);
+   upar.Fix("x4");
+
+   MnStrategy seqStrategy(1);
+   MnStrategy parStrategy(1);
+   parStrategy.SetParallelDerivatives(true);
+   EXPECT_FALSE(MnUseParallelDerivatives(seqStrategy, fcn));
+#ifdef R__USE_IMT
+   EXPECT_TRUE(MnUseParallelDerivatives(parStrategy, fcn));
+#endif
+
+   FunctionMinimum seqMin = MnMigrad(fcn, upar, seqStrategy)();
+   FunctionMinimum parMin = MnMigrad(fcn, upar, parStrategy)();
+   ASSERT_TRUE(seqMin.IsValid());
+   ASSERT_TRUE(parMin.IsValid());
+
+   auto compareMinima = [](const FunctionMinimum &seq, const FunctionMinimum &par) {
+      ExpectClose(par.Fval(), seq.Fval(), "minimum");
+      EXPECT_EQ(par.NFcn(), seq.NFcn());
+      const unsigned int nVar = seq.Grad().Vec().size();
+      ASSERT_EQ(par.Grad().Vec().size(), nVar);
+      for (unsigned int i = 0; i < nVar; ++i) {
+         ExpectClose(par.Grad().Vec()(i), seq.Grad().Vec()(i), "gradient " + std::to_string(i));
+         ExpectClose(par.Grad().G2()(i), seq.Grad().G2()(i), "second derivative " + std::to_string(i));
+      }
+      for (unsigned int i = 0; i < kNPar; ++i) {
+         ExpectClose(par.UserState().Value(i), seq.UserState().Value(i), "parameter " + std::to_string(i));
+      }
+      const MnUserCovariance &seqCov = seq.UserCovariance();
+      const MnUserCovariance &parCov = par.UserCovariance();
+      ASSERT_EQ(parCov.Nrow(), seqCov.Nrow());
+      for (unsigned int i = 0; i < seqCov.Nrow(); ++i) {
+         for (unsigned int j = 0; j <= i; ++j)
+            ExpectClose(parCov(i, j), seqCov(i, j), "covariance " + std::to_string(i) + ", " + std::to_string(j));
+      }
+   };
+
+   {
+      SCOPED_TRACE("Migrad");
+      compareMinima(seqMin, parMin);
+   }
+
+   MnHesse seqHesse(seqStrategy);
+   MnHesse parHesse(parStrategy);
+   seqHesse(fcn, seqMin);
+   parHesse(fcn, parMin);
+   {
+      SCOPED_TRACE("Hesse");
+      EXPECT_TRUE(parMin.HasAccurateCovar());
+      compareMinima(seqMin, parMin);
+   }
+}
+
+// The same through Minuit2Minimizer and its "ParallelDerivatives" extra option
+TEST(Minuit2Parallel, ParallelDerivativesOption)
+{
+   ImplicitMTGuard imtGuard(true);
+
+   ROOT::Minuit2::Minuit2Minimizer seq;
+   ROOT::Minuit2::Minuit2Minimizer par;
+   SetupMinimizer(seq, false);
+   SetupMinimizer(par, true);
+   ASSERT_TRUE(seq.Minimize());
+   ASSERT_TRUE(par.Minimize());
+   ASSERT_TRUE(seq.Hesse());
+   ASSERT_TRUE(par.Hesse());
+
+   ExpectClose(par.MinValue(), seq.MinValue(), "minimum");
+   EXPECT_EQ(par.NCalls(), seq.NCalls());
+   for (unsigned int i = 0; i < kNPar; ++i) {
+      ExpectClose(par.X()[i], seq.X()[i], "parameter " + std::to_string(i));
+      for (unsigned int j = 0; j < kNPar; ++j)
+         ExpectClose(par.CovMatrix(i, j), seq.CovMatrix(i, j),
+                     "covariance " + std::to_string(i) + ", " + std::to_string(j));
+   }
+}
@@ -1430,6 +1430,13 @@ are vectorized:
  - fast_expf, fast_logf, fast_sinf, fast_cosf, fast_tanf, fast_asinf, fast_acosf, fast_atanf
  - fast_exp, fast_log, fast_sin, fast_cos, fast_tan, fast_asin, fast_acos, fast_atan
 
+Operators and functions that receive a temporary RVec which owns its memory store the result in that memory
+rather than allocating a new RVec, as long as the type of the elements does not change. In an expression such as
+~~~{.cpp}
+auto pt = sqrt(px * px + py * py);
+~~~
+only the result of `px * px` is allocated, and it is then reused by the sum and by the square root.
+
 \anchor owningandadoptingmemory
 ## Owning and adopting memory
 RVec has contiguous memory associated to it. It can own it or simply adopt it. In the latter case,
@@ -1621,6 +1628,17 @@ RVec<T> operator OP(const RVec<T> &v)                                          \
    for (auto &x : ret)                                                         \
       x = OP x;                                                                \
 return ret;                                                                    \
+}                                                                              \
+                                                                               \
+/* temporaries that own their memory are reused as the result */               \
+template <typename T>                                                          \
+RVec<T> operator OP(RVec<T> &&v)                                               \
+{                                                                              \
+   if (ROOT::Detail::VecOps::IsAdopting(v))                                    \
+      return OP static_cast<const RVec<T> &>(v);                               \
+   for (auto &x : v)                                                           \
+      x = OP x;                                                                \
+   return std::move(v);                                                        \
 }                                                                              \
 
 RVEC_UNARY_OPERATOR(+)
@@ -1669,6 +1687,82 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
    std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
    return ret;                                                                 \
 }                                                                              \
+                                                                               \
+/* The overloads below reuse the memory of temporary operands as the result */ \
+/* when the element type does not change, so that expressions such as       */ \
+/* `a * b + c` do not allocate a new buffer for each operation.             */ \
+template <typename T0, typename T1>                                            \
+auto operator OP(RVec<T0> &&v, const T1 &y)                                    \
+  -> RVec<decltype(v[0] OP y)>                                                 \
+{                                                                              \
+   if constexpr (std::is_same<decltype(v[0] OP y), T0>::value) {               \
+      if (!ROOT::Detail::VecOps::IsAdopting(v)) {                              \
+         for (auto &x : v)                                                     \
+            x = x OP y;                                                        \
+         return std::move(v);                                                  \
+      }                                                                        \
+   }                                                                           \
+   return static_cast<const RVec<T0> &>(v) OP y;                               \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1>                                            \
+auto operator OP(const T0 &x, RVec<T1> &&v)                                    \
+  -> RVec<decltype(x OP v[0])>                                                 \
+{                                                                              \
+   if constexpr (std::is_same<decltype(x OP v[0]), T1>::value) {               \
+      if (!ROOT::Detail::VecOps::IsAdopting(v)) {                              \
+         for (auto &y : v)                                                     \
+            y = x OP y;                                                        \
+         return std::move(v);                                                  \
+      }                                                                        \
+   }                                                                           \
+   return x OP static_cast<const RVec<T1> &>(v);                               \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1>                                            \
+auto operator OP(RVec<T0> &&v0, const RVec<T1> &v1)                            \
+  -> RVec<decltype(v0[0] OP v1[0])>                                            \
+{                                                                              \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+                                                                               \
+   if constexpr (std::is_same<decltype(v0[0] OP v1[0]), T0>::value) {          \
+      if (!ROOT::Detail::VecOps::IsAdopting(v0)) {                             \
+         auto op = [](const T0 &x, const T1 &y) { return x OP y; };            \
+         std::transform(v0.begin(), v0.end(), v1.begin(), v0.begin(), op);    \
+         return std::move(v0);                                                 \
+      }                                                                        \
+   }                                                                           \
+   return static_cast<const RVec<T0> &>(v0) OP v1;                             \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1>                                            \
+auto operator OP(const RVec<T0> &v0, RVec<T1> &&v1)                            \
+  -> RVec<decltype(v0[0] OP v1[0])>                                            \
+{                                                                              \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+                                                                               \
+   if constexpr (std::is_same<decltype(v0[0] OP v1[0]), T1>::value) {          \
+      if (!ROOT::Detail::VecOps::IsAdopting(v1)) {                             \
+         auto op = [](const T0 &x, const T1 &y) { return x OP y; };            \
+         std::transform(v0.begin(), v0.end(), v1.begin(), v1.begin(), op);     \
+         return std::move(v1);                                                 \
+      }                                                                        \
+   }                                                                           \
+   return v0 OP static_cast<const RVec<T1> &>(v1);                             \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1>                                            \
+auto operator OP(RVec<T0> &&v0, RVec<T1> &&v1)                                 \
+  -> RVec<decltype(v0[0] OP v1[0])>                                            \
+{                                                                              \
+   if constexpr (std::is_same<decltype(v0[0] OP v1[0]), T0>::value) {          \
+      if (!ROOT::Detail::VecOps::IsAdopting(v0))                               \
+         return std::move(v0) OP static_cast<const RVec<T1> &>(v1);            \
+   }                                                                           \
+   return static_cast<const RVec<T0> &>(v0) OP std::move(v1);                  \
+}                                                                              \
 
 RVEC_BINARY_OPERATOR(+)
 RVEC_BINARY_OPERATOR(-)
@@ -1793,6 +1887,20 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       auto f = [](const T &x) { return FUNC(x); };                             \
       std::transform(v.begin(), v.end(), ret.begin(), f);                      \
       return ret;                                                              \
+   }                                                                           \
+                                                                               \
+   /* temporaries that own their memory are reused as the result */            \
+   template <typename T>                                                       \
+   RVec<PromoteType<T>> NAME(RVec<T> &&v)                                      \
+   {                                                                           \
+      if constexpr (std::is_same<PromoteType<T>, T>::value) {                  \
+         if (!ROOT::Detail::VecOps::IsAdopting(v)) {                           \
+            for (auto &x : v)                                                  \
+               x = FUNC(x);                                                    \
+            return std::move(v);                                               \
+         }                                                                     \
+      }                                                                        \
+      return NAME(static_cast<const RVec<T> &>(v));                            \
    }
 
 #define RVEC_BINARY_FUNCTION(NAME, FUNC)                                       \
@@ -1824,6 +1932,75 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       auto f = [](const T0 &x, const T1 &y) { return FUNC(x, y); };            \
       std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), f);        \
       return ret;                                                              \
+   }                                                                           \
+                                                                               \
+   /* temporaries that own their memory are reused as the result */            \
+   template <typename T0, typename T1>                                         \
+   RVec<PromoteTypes<T0, T1>> NAME(const T0 &x, RVec<T1> &&v)                  \
+   {                                                                           \
+      if constexpr (std::is_same<PromoteTypes<T0, T1>, T1>::value) {           \
+         if (!ROOT::Detail::VecOps::IsAdopting(v)) {                           \
+            for (auto &y : v)                                                  \
+               y = FUNC(x, y);                                                 \
+            return std::move(v);                                               \
+         }                                                                     \
+      }                                                                        \
+      return NAME(x, static_cast<const RVec<T1> &>(v));                        \
+   }                                                                           \
+                                                                               \
+   template <typename T0, typename T1>                                         \
+   RVec<PromoteTypes<T0, T1>> NAME(RVec<T0> &&v, const T1 &y)                  \
+   {                                                                           \
+      if constexpr (std::is_same<PromoteTypes<T0, T1>, T0>::value) {           \
+         if (!ROOT::Detail::VecOps::IsAdopting(v)) {                           \
+            for (auto &x : v)                                                  \
+               x = FUNC(x, y);                                                 \
+            return std::move(v);                                               \
+         }                                                                     \
+      }                                                                        \
+      return NAME(static_cast<const RVec<T0> &>(v), y);                        \
+   }                                                                           \
+                                                                               \
+   template <typename T0, typename T1>                                         \
+   RVec<PromoteTypes<T0, T1>> NAME(RVec<T0> &&v0, const RVec<T1> &v1)          \
+   {                                                                           \
+      if (v0.size() != v1.size())                                              \
+         throw std::runtime_error(ERROR_MESSAGE(NAME));                        \
+                                                                               \
+      if constexpr (std::is_same<PromoteTypes<T0, T1>, T0>::value) {           \
+         if (!ROOT::Detail::VecOps::IsAdopting(v0)) {                          \
+            auto f = [](const T0 &x, const T1 &y) { return FUNC(x, y); };      \
+            std::transform(v0.begin(), v0.end(), v1.begin(), v0.begin(), f);   \
+            return std::move(v0);                                              \
+         }                                                                     \
+      }                                                                        \
+      return NAME(static_cast<const RVec<T0> &>(v0), v1);                      \
+   }                                                                           \
+                                                                               \
+   template <typename T0, typename T1>                                         \
+   RVec<PromoteTypes<T0, T1>> NAME(const RVec<T0> &v0, RVec<T1> &&v1)          \
+   {                                                                           \
+      if (v0.size() != v1.size())                                              \
+         throw std::runtime_error(ERROR_MESSAGE(NAME));                        \
+                                                                               \
+      if constexpr (std::is_same<PromoteTypes<T0, T1>, T1>::value) {           \
+         if (!ROOT::Detail::VecOps::IsAdopting(v1)) {                          \
+            auto f = [](const T0 &x, const T1 &y) { return FUNC(x, y); };      \
+            std::transform(v0.begin(), v0.end(), v1.begin(), v1.begin(), f);   \
+            return std::move(v1);                                              \
+         }                                                                     \
+      }                                                                        \
+      return NAME(v0, static_cast<const RVec<T1> &>(v1));                      \
+   }                                                                           \
+                                                                               \
+   template <typename T0, typename T1>                                         \
+   RVec<PromoteTypes<T0, T1>> NAME(RVec<T0> &&v0, RVec<T1> &&v1)               \
+   {                                                                           \
+      if constexpr (std::is_same<PromoteTypes<T0, T1>, T0>::value) {           \
+         if (!ROOT::Detail::VecOps::IsAdopting(v0))                            \
+            return NAME(std::move(v0), static_cast<const RVec<T1> &>(v1));     \
+      }                                                                        \
+      return NAME(static_cast<const RVec<T0> &>(v0), std::move(v1));           \
    }                                                                           \
 
 #define RVEC_STD_UNARY_FUNCTION(F) RVEC_UNARY_FUNCTION(F, std::F)
@@ -2251,6 +2428,19 @@ RVec<typename RVec<T>::size_type> Argsort(const RVec<T> &v)
 {
    using size_type = typename RVec<T>::size_type;
    RVec<size_type> i(v.size());
+   if constexpr (std::is_arithmetic<T>::value) {
+      // For large collections of numbers, sorting (value, index) pairs is faster than sorting the indices
+      // alone: the comparisons then read contiguous memory instead of jumping around in v.
+      if (v.size() > 64) {
+         std::vector<std::pair<T, size_type>> pairs(v.size());
+         for (size_type k = 0; k < v.size(); ++k)
+            pairs[k] = {v[k], k};
+         std::sort(pairs.begin(), pairs.end(), [](const auto &p1, const auto &p2) { return p1.first < p2.first; });
+         for (size_type k = 0; k < v.size(); ++k)
+            i[k] = pairs[k].second;
+         return i;
+      }
+   }
    std::iota(i.begin(), i.end(), 0);
    std::sort(i.begin(), i.end(), [&v](size_type i1, size_type i2) { return v[i1] < v[i2]; });
    return i;
@@ -2609,13 +2799,13 @@ inline RVec<RVec<std::size_t>> Combinations(const std::size_t size1, const std::
    RVec<RVec<size_type>> r(2);
    r[0].resize(size1*size2);
    r[1].resize(size1*size2);
-   size_type c = 0;
-   for(size_type i=0; i<size1; i++) {
-      for(size_type j=0; j<size2; j++) {
-         r[0][c] = i;
-         r[1][c] = j;
-         c++;
-      }
+   size_type *first = r[0].data();
+   size_type *second = r[1].data();
+   for (size_type i = 0; i < size1; i++) {
+      std::fill_n(first, size2, i);
+      std::iota(second, second + size2, size_type(0));
+      first += size2;
+      second += size2;
    }
    return r;
 }
@@ -2687,6 +2877,21 @@ RVec<RVec<typename RVec<T>::size_type>> Combinations(const RVec<T>& v, const typ
    }();
 
    RVec<RVec<size_type>> c(n, RVec<size_type>(innersize));
+
+   // pairs are by far the most common case, and can be filled with two plain loops
+   if (n == 2) {
+      size_type *first = c[0].data();
+      size_type *second = c[1].data();
+      for (size_type i = 0; i + 1 < s; ++i) {
+         const size_type nPartners = s - i - 1;
+         std::fill_n(first, nPartners, i);
+         std::iota(second, second + nPartners, i + 1);
+         first += nPartners;
+         second += nPartners;
+      }
+      return c;
+   }
+
    size_type inneridx = 0;
    for (size_type k = 0; k < n; k++)
       c[k][inneridx] = indices[k];
@@ -2914,7 +3119,10 @@ Common_t DeltaPhi(T0 v1, T1 v2, const Common_t c = M_PI)
 {
    static_assert(std::is_floating_point<T0>::value && std::is_floating_point<T1>::value,
                  "DeltaPhi must be called with floating point values.");
-   auto r = std::fmod(v2 - v1, 2.0 * c);
+   decltype(std::fmod(v2 - v1, 2.0 * c)) r = v2 - v1;
+   // fmod would return r unchanged in the common case of angles in [-c, c], skip the expensive call
+   if (std::abs(r) >= 2.0 * c)
+      r = std::fmod(r, 2.0 * c);
    if (r < -c) {
       r += 2.0 * c;
    }
@@ -2988,8 +3196,14 @@ RVec<Common_t> DeltaPhi(T0 v1, const RVec<T1>& v2, const Common_t c = M_PI)
 template <typename T0, typename T1 = T0, typename T2 = T0, typename T3 = T0, typename Common_t = std::common_type_t<T0, T1, T2, T3>>
 RVec<Common_t> DeltaR2(const RVec<T0>& eta1, const RVec<T1>& eta2, const RVec<T2>& phi1, const RVec<T3>& phi2, const Common_t c = M_PI)
 {
-   const auto dphi = DeltaPhi(phi1, phi2, c);
-   return (eta1 - eta2) * (eta1 - eta2) + dphi * dphi;
+   const auto size = ::ROOT::Internal::VecOps::GetVectorsSize("DeltaR2", eta1, eta2, phi1, phi2);
+   RVec<Common_t> r(size);
+   for (std::size_t i = 0u; i < size; ++i) {
+      const auto deta = eta1[i] - eta2[i];
+      const auto dphi = DeltaPhi(phi1[i], phi2[i], c);
+      r[i] = deta * deta + dphi * dphi;
+   }
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -3002,7 +3216,10 @@ RVec<Common_t> DeltaR2(const RVec<T0>& eta1, const RVec<T1>& eta2, const RVec<T2
 template <typename T0, typename T1 = T0, typename T2 = T0, typename T3 = T0, typename Common_t = std::common_type_t<T0, T1, T2, T3>>
 RVec<Common_t> DeltaR(const RVec<T0>& eta1, const RVec<T1>& eta2, const RVec<T2>& phi1, const RVec<T3>& phi2, const Common_t c = M_PI)
 {
-   return sqrt(DeltaR2(eta1, eta2, phi1, phi2, c));
+   auto r = DeltaR2(eta1, eta2, phi1, phi2, c);
+   for (auto &x : r)
+      x = std::sqrt(x);
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -3038,27 +3255,22 @@ RVec<Common_t> InvariantMasses(
    RVec<Common_t> inv_masses(size);
 
    for (std::size_t i = 0u; i < size; ++i) {
-      // Conversion from (pt, eta, phi, mass) to (x, y, z, e) coordinate system
-      const auto x1 = pt1[i] * std::cos(phi1[i]);
-      const auto y1 = pt1[i] * std::sin(phi1[i]);
-      const auto z1 = pt1[i] * std::sinh(eta1[i]);
-      const auto e1 = std::sqrt(x1 * x1 + y1 * y1 + z1 * z1 + mass1[i] * mass1[i]);
-
-      const auto x2 = pt2[i] * std::cos(phi2[i]);
-      const auto y2 = pt2[i] * std::sin(phi2[i]);
-      const auto z2 = pt2[i] * std::sinh(eta2[i]);
-      const auto e2 = std::sqrt(x2 * x2 + y2 * y2 + z2 * z2 + mass2[i] * mass2[i]);
-
-      // Addition of particle four-vector elements
-      const auto e = e1 + e2;
-      const auto x = x1 + x2;
-      const auto y = y1 + y2;
-      const auto z = z1 + z2;
-
-      inv_masses[i] = std::sqrt(e * e - x * x - y * y - z * z);
+      // With the (+, -, -, -) metric, m^2 = m1^2 + m2^2 + 2 * (e1 * e2 - p1 . p2), where
+      // p1 . p2 = pt1 * pt2 * (cos(phi1 - phi2) + sinh(eta1) * sinh(eta2)) and e^2 = pt^2 + (pt * sinh(eta))^2 + m^2.
+      // This needs three calls to transcendental functions per pair instead of six.
+      const Common_t p1 = pt1[i];
+      const Common_t p2 = pt2[i];
+      const Common_t m1 = mass1[i];
+      const Common_t m2 = mass2[i];
+      const Common_t z1 = p1 * std::sinh(eta1[i]);
+      const Common_t z2 = p2 * std::sinh(eta2[i]);
+      const auto e1 = std::sqrt(p1 * p1 + z1 * z1 + m1 * m1);
+      const auto e2 = std::sqrt(p2 * p2 + z2 * z2 + m2 * m2);
+      const auto p1p2 = p1 * p2 * std::cos(Common_t(phi1[i]) - phi2[i]) + z1 * z2;
+
+      inv_masses[i] = std::sqrt(m1 * m1 + m2 * m2 + 2 * (e1 * e2 - p1p2));
    }
 
-   // Return invariant mass with (+, -, -, -) metric
    return inv_masses;
 }
 
@@ -3087,7 +3299,7 @@ Common_t InvariantMass(const RVec<T0>& pt, const RVec<T1>& eta, const RVec<T2>&
       y_sum += y;
       const auto z = pt[i] * std::sinh(eta[i]);
       z_sum += z;
-      const auto e = std::sqrt(x * x + y * y + z * z + mass[i] * mass[i]);
+      const auto e = std::sqrt(pt[i] * pt[i] + z * z + mass[i] * mass[i]);
       e_sum += e;
    }
 
@@ -299,6 +299,53 @@ TEST(VecOps, MathVectorInPlace)
    CheckEqual(div, ref / vec);
 }
 
+TEST(VecOps, MathTemporaries)
+{
+   // large enough not to fit in the small buffer
+   RVec<double> v(100);
+   std::iota(v.begin(), v.end(), 1.);
+   const RVec<double> w = v * 2.;
+
+   CheckEqual(-RVec<double>(v), -v);
+   CheckEqual(RVec<double>(v) + 2., v + 2.);
+   CheckEqual(2. - RVec<double>(v), 2. - v);
+   CheckEqual(RVec<double>(v) * w, v * w);
+   CheckEqual(w / RVec<double>(v), w / v);
+   CheckEqual(RVec<double>(v) - RVec<double>(w), v - w);
+   CheckEqual(sqrt(RVec<double>(v)), sqrt(v));
+   CheckEqual(pow(RVec<double>(v), 2), pow(v, 2));
+   CheckEqual(pow(2., RVec<double>(v)), pow(2., v));
+   CheckEqual(atan2(RVec<double>(v), w), atan2(v, w));
+   CheckEqual(atan2(v, RVec<double>(w)), atan2(v, w));
+   CheckEqual(sqrt(v * v + w * w), Map(v, w, [](double x, double y) { return std::sqrt(x * x + y * y); }));
+
+   // the memory of the temporaries is reused for the result
+   RVec<double> tmp(v);
+   const auto *data = tmp.data();
+   auto res = sqrt(std::move(tmp) * w + 1.);
+   EXPECT_EQ(res.data(), data);
+   CheckEqual(res, sqrt(v * w + 1.));
+
+   // unless the element type changes
+   RVec<int> ints{1, 2, 3};
+   const auto *intData = ints.data();
+   auto doubles = std::move(ints) * 0.5;
+   EXPECT_NE(static_cast<const void *>(doubles.data()), static_cast<const void *>(intData));
+   CheckEqual(doubles, RVec<double>{0.5, 1., 1.5});
+   CheckEqual(sqrt(RVec<int>{1, 4, 9}), RVec<double>{1., 2., 3.});
+
+   // or the temporary adopts memory it does not own
+   std::vector<double> buffer{1., 2., 3.};
+   auto adopted = RVec<double>(buffer.data(), buffer.size()) + 1.;
+   CheckEqual(adopted, RVec<double>{2., 3., 4.});
+   CheckEqual(buffer, std::vector<double>{1., 2., 3.});
+   CheckEqual(-RVec<double>(buffer.data(), buffer.size()), RVec<double>{-1., -2., -3.});
+   CheckEqual(buffer, std::vector<double>{1., 2., 3.});
+
+   EXPECT_THROW(RVec<double>(v) + RVec<double>(3), std::runtime_error);
+   EXPECT_THROW(pow(RVec<double>(v), RVec<double>(3)), std::runtime_error);
+}
+
 TEST(VecOps, Filter)
 {
    RVec<int> v{0, 1, 2, 3, 4, 5};
@@ -734,6 +781,19 @@ TEST(VecOps, Argsort)
    CheckEqual(i, ref);
 }
 
+TEST(VecOps, ArgsortLarge)
+{
+   RVec<double> v(1000);
+   for (std::size_t k = 0; k < v.size(); ++k)
+      v[k] = std::sin(k * 0.37) * 10.;
+   auto i = Argsort(v);
+   ASSERT_EQ(i.size(), v.size());
+   auto sorted = Take(v, i);
+   EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+   std::sort(i.begin(), i.end());
+   CheckEqual(i, Range(v.size()));
+}
+
 TEST(VecOps, ArgsortWithComparisonOperator)
 {
    RVec<int> v{2, 0, 1};
@@ -1252,6 +1312,26 @@ TEST(VecOps, InvariantMass)
       EXPECT_NEAR((p1 + p2).M(), invMass[i], 1e-4);
    }
 
+   // Light and heavy, central and forward particles
+   RVec<double> ptA, etaA, phiA, massA, ptB, etaB, phiB, massB;
+   for (int i = 0; i < 50; ++i) {
+      ptA.push_back(1. + 3. * i);
+      etaA.push_back(-4. + 0.15 * i);
+      phiA.push_back(-3. + 0.12 * i);
+      massA.push_back(i % 3 == 0 ? 0. : 0.1 * i);
+      ptB.push_back(200. - 2. * i);
+      etaB.push_back(3. - 0.13 * i);
+      phiB.push_back(3.1 - 0.11 * i);
+      massB.push_back(i % 4 == 0 ? 0. : 91.2);
+   }
+   const auto invMassAB = InvariantMasses(ptA, etaA, phiA, massA, ptB, etaB, phiB, massB);
+   for (size_t i = 0; i < ptA.size(); i++) {
+      TLorentzVector p1, p2;
+      p1.SetPtEtaPhiM(ptA[i], etaA[i], phiA[i], massA[i]);
+      p2.SetPtEtaPhiM(ptB[i], etaB[i], phiB[i], massB[i]);
+      EXPECT_NEAR((p1 + p2).M(), invMassAB[i], 1e-6 * (p1 + p2).E());
+   }
+
    // Compute invariant mass of multiple-particle system using a single collection
    const auto invMass2 = InvariantMass(pt1, eta1, phi1, mass1);
 
@@ -1320,6 +1400,12 @@ TEST(VecOps, DeltaR)
       EXPECT_NEAR(dr3, dr4, 1e-6);
    }
 
+   auto dr5 = DeltaR2(eta1, eta2, phi1, phi2);
+   for (std::size_t i = 0; i < eta1.size(); i++)
+      EXPECT_DOUBLE_EQ(dr5[i], dr[i] * dr[i]);
+
+   EXPECT_THROW(DeltaR(eta1, eta2, phi1, RVec<double>{0.}), std::runtime_error);
+
    // Check that calling with different argument types works and yields the
    // expected return types and values
    RVec<float> etaf = {0.1f, -1.f, -1.f, 0.5f, -2.5f};
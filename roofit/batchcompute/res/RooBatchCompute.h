@@ -52,6 +52,11 @@ void init();
 /// the RooBatchCompute library.
 class Config {
 public:
+   /// Split the events of large computations on the CPU into chunks that are
+   /// processed in parallel, if implicit multi-threading is enabled.
+   void setMultiThreaded(bool flag) { _multiThreaded = flag; }
+   bool multiThreaded() const { return _multiThreaded; }
+
 #ifdef ROOFIT_CUDA
    bool useCuda() const { return _cudaStream != nullptr; }
    void setCudaStream(RooFit::Detail::CudaInterface::CudaStream *cudaStream) { _cudaStream = cudaStream; }
@@ -62,6 +67,9 @@ private:
 #else
    bool useCuda() const { return false; }
 #endif
+
+private:
+   bool _multiThreaded = false;
 };
 
 enum class Architecture { AVX512, AVX2, AVX, SSE4, GENERIC, CUDA };
@@ -27,6 +27,7 @@ This file contains the code for cpu computations using the RooBatchCompute libra
 
 #ifdef ROOBATCHCOMPUTE_USE_IMT
 #include <ROOT/TExecutor.hxx>
+#include <TROOT.h>
 #endif
 
 #include <Math/Util.h>
@@ -62,6 +63,12 @@ void fillArrays(std::span<Batch> arrays, VarSpan vars, std::size_t nEvents)
    }
 }
 
+#ifdef ROOBATCHCOMPUTE_USE_IMT
+// Splitting a computation in chunks with fewer events is not worth the
+// overhead of scheduling the tasks.
+constexpr std::size_t minEventsPerTask = 256 * bufferSize;
+#endif
+
 inline void advance(Batches &batches, std::size_t nEvents)
 {
    for (std::size_t i = 0; i < batches.nBatches; i++) {
@@ -120,7 +127,9 @@ void RooBatchComputeClass::computeIMT(Computer computer, std::span<double> outpu
    if (nEvents == 0)
       return;
    ROOT::Internal::TExecutor ex;
-   std::size_t nThreads = ex.GetPoolSize();
+   std::size_t nThreads = std::min<std::size_t>(ex.GetPoolSize(), nEvents / minEventsPerTask);
+   if (nThreads == 0)
+      nThreads = 1;
 
    std::size_t nEventsPerThread = nEvents / nThreads + (nEvents % nThreads > 0);
 
@@ -164,14 +173,14 @@ void RooBatchComputeClass::computeIMT(Computer computer, std::span<double> outpu
 
 /** Compute multiple values using optimized functions.
 This method creates a Batches object and passes it to the correct compute function.
-In case Implicit Multithreading is enabled, the events to be processed are equally
-divided among the tasks to be generated and computed in parallel.
+In case Implicit Multithreading is enabled and the configuration asks for it, the
+events to be processed are equally divided among the tasks to be generated and computed in parallel.
 \param computer An enum specifying the compute function to be used.
 \param output The array where the computation results are stored.
 \param vars A std::span containing pointers to the variables involved in the computation.
 \param extraArgs An optional std::span containing extra double values that may participate in the computation. **/
-void RooBatchComputeClass::compute(Config const &, Computer computer, std::span<double> output, VarSpan vars,
-                                   ArgSpan extraArgs)
+void RooBatchComputeClass::compute([[maybe_unused]] Config const &cfg, Computer computer, std::span<double> output,
+                                   VarSpan vars, ArgSpan extraArgs)
 {
    // In the original implementation of this library, the evaluation was done
    // multi-threaded in implicit multi-threading was enabled in ROOT with
@@ -191,9 +200,14 @@ void RooBatchComputeClass::compute(Config const &, Computer computer, std::span<
    // performance of the new CPU evaluation backend with the RooBatchCompute
    // library, is generally much faster than the legacy evaluation backend
    // already, even if the latter uses multi-threading.
+   //
+   // That's why the events are only split among threads if this is explicitly
+   // requested in the Config, which the RooFit::Evaluator does only for large
+   // nodes if implicit multi-threading was enabled when it was created.
 #ifdef ROOBATCHCOMPUTE_USE_IMT
-   if (ROOT::IsImplicitMTEnabled()) {
+   if (cfg.multiThreaded() && output.size() >= 2 * minEventsPerTask && ROOT::IsImplicitMTEnabled()) {
       computeIMT(computer, output, vars, extraArgs);
+      return;
    }
 #endif
 
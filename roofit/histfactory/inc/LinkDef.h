@@ -16,6 +16,7 @@
 
 #pragma link C++ class PiecewiseInterpolation- ;
 #pragma link C++ class ParamHistFunc+ ;
+#pragma link C++ class RooStats::HistFactory::ParamHistConstraint+ ;
 #pragma link C++ class RooStats::HistFactory::LinInterpVar+ ;
 #pragma link C++ class RooStats::HistFactory::FlexibleInterpVar+ ;
 #pragma link C++ class RooStats::HistFactory::HistoToWorkspaceFactoryFast+ ;
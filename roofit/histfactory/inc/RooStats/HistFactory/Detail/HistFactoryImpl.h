@@ -56,6 +56,10 @@ CreateGammaConstraintsOutput createGammaConstraints(RooArgList const &paramList,
                                                     std::span<const double> relSigmas, double minSigma,
                                                     Constraint::Type type);
 
+CreateGammaConstraintsOutput createBulkGammaConstraint(std::string const &name, RooArgList const &paramList,
+                                                       std::span<const double> relSigmas, double minSigma,
+                                                       Constraint::Type type);
+
 } // namespace Detail
 } // namespace HistFactory
 } // namespace RooStats
@@ -47,6 +47,10 @@ namespace RooStats{
 
       struct Configuration {
         bool binnedFitOptimization = true;
+        /// Represent the constraint terms of all gamma parameters of a stat
+        /// error or shape systematic by one ParamHistConstraint, instead of
+        /// one RooPoisson or RooGaussian per bin.
+        bool bulkGammaConstraints = false;
       };
 
       HistoToWorkspaceFactoryFast() {}
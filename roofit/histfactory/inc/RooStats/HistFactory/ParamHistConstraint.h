@@ -0,0 +1,72 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOSTATS_PARAMHISTCONSTRAINT
+#define ROOSTATS_PARAMHISTCONSTRAINT
+
+#include <RooAbsPdf.h>
+#include <RooListProxy.h>
+
+#include <RooStats/HistFactory/Systematics.h>
+
+#include <vector>
+
+namespace RooStats {
+namespace HistFactory {
+
+class ParamHistConstraint : public RooAbsPdf {
+public:
+   ParamHistConstraint() = default;
+   ParamHistConstraint(const char *name, const char *title, const RooArgList &gammas, const RooArgList &nominals,
+                       std::vector<double> const &relSigmas, Constraint::Type type);
+   ParamHistConstraint(const ParamHistConstraint &other, const char *name = nullptr);
+   TObject *clone(const char *newname) const override { return new ParamHistConstraint(*this, newname); }
+
+   const RooArgList &gammas() const { return _gammas; }
+   const RooArgList &nominals() const { return _nominals; }
+   const std::vector<double> &relSigmas() const { return _relSigmas; }
+   Constraint::Type constraintType() const { return _type; }
+
+   double getLogVal(const RooArgSet *normSet = nullptr) const override;
+
+   Int_t getAnalyticalIntegral(RooArgSet &allVars, RooArgSet &analVars, const char *rangeName = nullptr) const override;
+   double analyticalIntegral(Int_t code, const char *rangeName = nullptr) const override;
+
+   Int_t getGenerator(const RooArgSet &directVars, RooArgSet &generateVars, bool staticInitOK = true) const override;
+   void generateEvent(Int_t code) override;
+
+   std::unique_ptr<RooAbsArg>
+   compileLogValueForNormSet(RooArgSet const &normSet, RooFit::Detail::CompileContext &ctx) const override;
+
+   void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
+protected:
+   double evaluate() const override;
+   void doEval(RooFit::EvalContext &) const override;
+
+private:
+   double logTerm(std::size_t i, double gamma, double nominal) const;
+   double logIntegralTerm(std::size_t i, double gamma, const char *rangeName) const;
+   double logIntegral(const char *rangeName) const;
+
+   RooListProxy _gammas;
+   RooListProxy _nominals;
+   std::vector<double> _relSigmas;
+   Constraint::Type _type = Constraint::Gaussian;
+   bool _logValueInEval = false;  ///<! Output the logarithm of the value in doEval(), set for compiled clones
+   bool _normalizeInEval = false; ///<! Normalize over the global observables in doEval(), set for compiled clones
+   std::vector<double> _xMins;    ///<! Lower bounds of the global observables for the normalization
+   std::vector<double> _xMaxs;    ///<! Upper bounds of the global observables for the normalization
+
+   ClassDefOverride(RooStats::HistFactory::ParamHistConstraint, 1)
+};
+
+} // namespace HistFactory
+} // namespace RooStats
+
+#endif
@@ -222,25 +222,18 @@ void FlexibleInterpVar::translate(RooFit::Detail::CodeSquashContext &ctx) const
 {
    unsigned int n = _interpCode.size();
 
-   int interpCode = _interpCode[0];
-   if (interpCode < 0 || interpCode > 4) {
-      coutE(InputArguments) << "FlexibleInterpVar::evaluate ERROR:  param " << 0
-                            << " with unknown interpolation code" << std::endl;
-   }
-   // To get consistent codes with the PiecewiseInterpolation
-   if (interpCode == 4) {
-      interpCode = 5;
-   }
-
-   for (unsigned int i = 1; i < n; i++) {
-      if (_interpCode[i] != _interpCode[0]) {
-         coutE(InputArguments) << "FlexibleInterpVar::evaluate ERROR:  Code Squashing AD does not yet support having "
-                                  "different interpolation codes for the same class object "
-                               << std::endl;
+   std::vector<int> interpCodes(n);
+   for (unsigned int i = 0; i < n; i++) {
+      int code = _interpCode[i];
+      if (code < 0 || code > 4) {
+         coutE(InputArguments) << "FlexibleInterpVar::evaluate ERROR:  param " << i
+                               << " with unknown interpolation code" << std::endl;
       }
+      // To get consistent codes with the PiecewiseInterpolation
+      interpCodes[i] = code == 4 ? 5 : code;
    }
 
-   std::string const &resName = ctx.buildCall("RooFit::Detail::MathFuncs::flexibleInterp", interpCode,
+   std::string const &resName = ctx.buildCall("RooFit::Detail::MathFuncs::flexibleInterp", interpCodes,
                                               _paramList, n, _low, _high, _interpBoundary, _nominal, 1.0);
    ctx.addResult(this, resName);
 }
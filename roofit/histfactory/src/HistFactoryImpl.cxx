@@ -13,6 +13,7 @@
 #include <RooStats/HistFactory/Detail/HistFactoryImpl.h>
 
 #include <RooStats/HistFactory/HistFactoryException.h>
+#include <RooStats/HistFactory/ParamHistConstraint.h>
 
 #include <RooConstVar.h>
 #include <RooGaussian.h>
@@ -182,6 +183,80 @@ CreateGammaConstraintsOutput createGammaConstraints(RooArgList const &paramSet,
    return out;
 }
 
+// Same as createGammaConstraints(), but all constraint terms are represented
+// by a single ParamHistConstraint. This replaces the per-bin constraint pdfs
+// and their helper objects (3 objects per bin for Gaussian and 4 for Poisson
+// constraints) by one RooRealVar per bin and one node in total. The global
+// observables are still created per bin, because they need to be RooRealVars,
+// and the gammas and the ParamHistFunc are not changed.
+CreateGammaConstraintsOutput createBulkGammaConstraint(std::string const &name, RooArgList const &paramSet,
+                                                       std::span<const double> relSigmas, double minSigma,
+                                                       Constraint::Type type)
+{
+   CreateGammaConstraintsOutput out;
+
+   if (relSigmas.size() != paramSet.size()) {
+      std::cout << "Error: In createBulkGammaConstraint, encountered bad number of relative sigmas" << std::endl;
+      std::cout << "Given vector with " << relSigmas.size() << " bins,"
+                << " but require exactly " << paramSet.size() << std::endl;
+      throw hf_exc();
+   }
+
+   if (type != Constraint::Gaussian && type != Constraint::Poisson) {
+      std::cout << "Error: Did not recognize Stat Error constraint term type: " << type << " for : " << name
+                << std::endl;
+      throw hf_exc();
+   }
+
+   configureConstrainedGammas(paramSet, relSigmas, minSigma);
+
+   RooArgList gammas;
+   RooArgList nominals;
+   std::vector<double> sigmas;
+   std::vector<std::unique_ptr<RooRealVar>> ownedNominals;
+
+   for (std::size_t i = 0; i < paramSet.size(); ++i) {
+      const double sigmaRel = relSigmas[i];
+      // Like in createGammaConstraints(), there is no constraint term for bins with sigma <= 0
+      if (sigmaRel <= 0) {
+         continue;
+      }
+
+      RooRealVar &gamma = static_cast<RooRealVar &>(paramSet[i]);
+      std::string nomName = std::string("nom_") + gamma.GetName();
+
+      std::unique_ptr<RooRealVar> constrNom;
+      if (type == Constraint::Gaussian) {
+         constrNom = std::make_unique<RooRealVar>(nomName.c_str(), nomName.c_str(), 1.0, 0, 10);
+      } else {
+         constrNom = std::make_unique<RooRealVar>(nomName.c_str(), nomName.c_str(), 1. / (sigmaRel * sigmaRel));
+         constrNom->setMin(0);
+      }
+      constrNom->setConstant(true);
+
+      gammas.add(gamma);
+      nominals.add(*constrNom);
+      sigmas.push_back(sigmaRel);
+      out.globalObservables.push_back(constrNom.get());
+      ownedNominals.emplace_back(std::move(constrNom));
+   }
+
+   if (gammas.empty()) {
+      return out;
+   }
+
+   oocxcoutI(nullptr, HistFactory) << "Creating constraint " << name << " for " << gammas.size()
+                                   << " gamma parameters. Type of constraint: " << type << std::endl;
+
+   auto term = std::make_unique<ParamHistConstraint>(name.c_str(), name.c_str(), gammas, nominals, sigmas, type);
+   for (auto &nominal : ownedNominals) {
+      term->addOwnedComponents(std::move(nominal));
+   }
+   out.constraints.emplace_back(std::move(term));
+
+   return out;
+}
+
 } // namespace Detail
 } // namespace HistFactory
 } // namespace RooStats
@@ -1137,10 +1137,14 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
               systype = Constraint::Poisson;
             }
 
-            auto shapeConstraintsInfo = createGammaConstraints(
-                paramHist->paramList(), histToVector(*shapeErrorHist),
-                minShapeUncertainty,
-                systype);
+            auto shapeConstraintsInfo = fCfg.bulkGammaConstraints
+                ? createBulkGammaConstraint(funcName + "_constraint",
+                    paramHist->paramList(), histToVector(*shapeErrorHist),
+                    minShapeUncertainty, systype)
+                : createGammaConstraints(
+                    paramHist->paramList(), histToVector(*shapeErrorHist),
+                    minShapeUncertainty,
+                    systype);
             for (auto const& term : shapeConstraintsInfo.constraints) {
                proto.import(*term, RooFit::RecycleConflictNodes());
                constraintTermNames.emplace_back(term->GetName());
@@ -1225,10 +1229,14 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
       }
 
       double statRelErrorThreshold = channel.GetStatErrorConfig().GetRelErrorThreshold();
-      auto statConstraintsInfo = createGammaConstraints(
-          chanStatUncertFunc->paramList(), histToVector(*fracStatError),
-          statRelErrorThreshold,
-          statConstraintType);
+      auto statConstraintsInfo = fCfg.bulkGammaConstraints
+          ? createBulkGammaConstraint(statFuncName + "_constraint",
+              chanStatUncertFunc->paramList(), histToVector(*fracStatError),
+              statRelErrorThreshold, statConstraintType)
+          : createGammaConstraints(
+              chanStatUncertFunc->paramList(), histToVector(*fracStatError),
+              statRelErrorThreshold,
+              statConstraintType);
       for (auto const& term : statConstraintsInfo.constraints) {
          proto.import(*term, RooFit::RecycleConflictNodes());
          constraintTermNames.emplace_back(term->GetName());
@@ -0,0 +1,302 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class RooStats::HistFactory::ParamHistConstraint
+ *  \ingroup HistFactory
+ *
+ * Product of the constraint terms of the bin-wise gamma parameters of a
+ * ParamHistFunc, in a single node.
+ *
+ * By default, HistFactory creates for each constrained gamma parameter a
+ * RooGaussian or RooPoisson, a global observable and one or two helper
+ * objects. A ParamHistConstraint represents the same constraint terms with
+ * one node per ParamHistFunc: it only holds the gammas, the global
+ * observables and an array with the relative uncertainties. The gammas and
+ * the global observables remain separate RooRealVars for each bin.
+ *
+ * For each gamma parameter \f$ \gamma_i \f$ with relative uncertainty
+ * \f$ \sigma_i \f$ and global observable \f$ n_i \f$, the factor is
+ * - for Gaussian constraints: \f$ \exp(-\frac{1}{2} (n_i - \gamma_i)^2 / \sigma_i^2) \f$,
+ *   like a RooGaussian with mean \f$ \gamma_i \f$;
+ * - for Poisson constraints: \f$ \mathrm{Pois}(n_i | \gamma_i \tau_i) \f$ with
+ *   \f$ \tau_i = 1 / \sigma_i^2 \f$, like a RooPoisson without rounding.
+ *
+ * The logarithm of the product is computed as a sum of logarithms, so that
+ * getLogVal() doesn't under- or overflow for large numbers of bins. In the
+ * compiled computation graph of a likelihood, the RooConstraintSum gets a
+ * clone whose output is directly the normalized logarithm, see
+ * compileLogValueForNormSet().
+ *
+ * The models that use this class are created with the `bulkGammaConstraints`
+ * option of HistoToWorkspaceFactoryFast::Configuration, or with
+ * RooJSONFactoryWSTool::setBulkGammaConstraints() for the HS3 JSON importer.
+ */
+
+#include <RooStats/HistFactory/ParamHistConstraint.h>
+
+#include <RooFit/Detail/CodeSquashContext.h>
+#include <RooFit/Detail/MathFuncs.h>
+#include <RooFit/Detail/NormalizationHelpers.h>
+#include <RooFit/EvalContext.h>
+#include <RooMsgService.h>
+#include <RooRandom.h>
+#include <RooRealVar.h>
+
+#include <TRandom.h>
+
+#include <cmath>
+#include <stdexcept>
+
+ClassImp(RooStats::HistFactory::ParamHistConstraint);
+
+namespace RooStats {
+namespace HistFactory {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor.
+/// \param[in] name Name of the constraint.
+/// \param[in] title Title of the constraint.
+/// \param[in] gammas The constrained gamma parameters.
+/// \param[in] nominals The global observables, one RooRealVar for each gamma.
+/// \param[in] relSigmas The relative uncertainty of each gamma. All values must be positive.
+/// \param[in] type The type of the constraint terms, Gaussian or Poisson.
+
+ParamHistConstraint::ParamHistConstraint(const char *name, const char *title, const RooArgList &gammas,
+                                         const RooArgList &nominals, std::vector<double> const &relSigmas,
+                                         Constraint::Type type)
+   : RooAbsPdf(name, title),
+     _gammas("gammas", "gamma parameters", this),
+     _nominals("nominals", "global observables", this),
+     _relSigmas(relSigmas),
+     _type(type)
+{
+   if (gammas.size() != nominals.size() || gammas.size() != relSigmas.size()) {
+      throw std::invalid_argument(std::string("ParamHistConstraint ") + name +
+                                  ": the numbers of gammas, global observables and sigmas are different");
+   }
+   if (type != Constraint::Gaussian && type != Constraint::Poisson) {
+      throw std::invalid_argument(std::string("ParamHistConstraint ") + name + ": unknown constraint type");
+   }
+   _gammas.addTyped<RooAbsReal>(gammas);
+   _nominals.addTyped<RooAbsRealLValue>(nominals);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy constructor.
+
+ParamHistConstraint::ParamHistConstraint(const ParamHistConstraint &other, const char *name)
+   : RooAbsPdf(other, name),
+     _gammas("gammas", this, other._gammas),
+     _nominals("nominals", this, other._nominals),
+     _relSigmas(other._relSigmas),
+     _type(other._type),
+     _logValueInEval(other._logValueInEval),
+     _normalizeInEval(other._normalizeInEval),
+     _xMins(other._xMins),
+     _xMaxs(other._xMaxs)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Logarithm of the unnormalized constraint term of bin i.
+
+double ParamHistConstraint::logTerm(std::size_t i, double gamma, double nominal) const
+{
+   return RooFit::Detail::MathFuncs::gammaConstraintLog(gamma, nominal, _relSigmas[i], _type == Constraint::Poisson);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Logarithm of the integral of the constraint term of bin i over its global observable.
+
+double ParamHistConstraint::logIntegralTerm(std::size_t i, double gamma, const char *rangeName) const
+{
+   auto const &nominal = static_cast<RooAbsRealLValue const &>(_nominals[i]);
+   return RooFit::Detail::MathFuncs::gammaConstraintLogIntegral(gamma, _relSigmas[i], nominal.getMin(rangeName),
+                                                                nominal.getMax(rangeName), _type == Constraint::Poisson);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Logarithm of the integral over all global observables.
+
+double ParamHistConstraint::logIntegral(const char *rangeName) const
+{
+   double out = 0.0;
+   for (std::size_t i = 0; i < _gammas.size(); ++i) {
+      out += logIntegralTerm(i, static_cast<RooAbsReal const &>(_gammas[i]).getVal(), rangeName);
+   }
+   return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double ParamHistConstraint::evaluate() const
+{
+   double logVal = 0.0;
+   for (std::size_t i = 0; i < _gammas.size(); ++i) {
+      logVal += logTerm(i, static_cast<RooAbsReal const &>(_gammas[i]).getVal(),
+                        static_cast<RooAbsReal const &>(_nominals[i]).getVal());
+   }
+   return std::exp(logVal);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The clones compiled with compileLogValueForNormSet() output the logarithm
+/// of the value, normalized bin by bin over the global observables if needed.
+
+void ParamHistConstraint::doEval(RooFit::EvalContext &ctx) const
+{
+   double logVal = 0.0;
+   for (std::size_t i = 0; i < _gammas.size(); ++i) {
+      const double gamma = ctx.at(&_gammas[i])[0];
+      logVal += logTerm(i, gamma, ctx.at(&_nominals[i])[0]);
+      if (_normalizeInEval) {
+         logVal -= RooFit::Detail::MathFuncs::gammaConstraintLogIntegral(gamma, _relSigmas[i], _xMins[i], _xMaxs[i],
+                                                                         _type == Constraint::Poisson);
+      }
+   }
+   const double val = _logValueInEval ? logVal : std::exp(logVal);
+   std::span<double> output = ctx.output();
+   for (std::size_t i = 0; i < output.size(); ++i) {
+      output[i] = val;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the logarithm of the constraint value, computed as a sum over the
+/// bins. If the normalization set contains all global observables, the value
+/// is normalized over them. If it contains only some of them, the default
+/// implementation of RooAbsPdf is used.
+
+double ParamHistConstraint::getLogVal(const RooArgSet *normSet) const
+{
+   std::size_t nNormObs = 0;
+   if (normSet) {
+      for (RooAbsArg *nominal : _nominals) {
+         if (normSet->find(*nominal))
+            ++nNormObs;
+      }
+   }
+   if (nNormObs != 0 && nNormObs != _nominals.size()) {
+      return RooAbsPdf::getLogVal(normSet);
+   }
+
+   double logVal = 0.0;
+   for (std::size_t i = 0; i < _gammas.size(); ++i) {
+      logVal += logTerm(i, static_cast<RooAbsReal const &>(_gammas[i]).getVal(),
+                        static_cast<RooAbsReal const &>(_nominals[i]).getVal());
+   }
+   if (nNormObs != 0) {
+      logVal -= logIntegral(nullptr);
+   }
+   return logVal;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compile a clone that outputs the logarithm of the constraint value, like
+/// getLogVal(). The normalization over the global observables is done bin by
+/// bin in log space, so the output doesn't under- or overflow for many bins.
+/// If the normalization set contains only some of the global observables, no
+/// such node is created.
+
+std::unique_ptr<RooAbsArg>
+ParamHistConstraint::compileLogValueForNormSet(RooArgSet const &normSet, RooFit::Detail::CompileContext &ctx) const
+{
+   std::size_t nNormObs = 0;
+   for (RooAbsArg *nominal : _nominals) {
+      if (normSet.find(*nominal))
+         ++nNormObs;
+   }
+   if (nNormObs != 0 && nNormObs != _nominals.size()) {
+      return nullptr;
+   }
+
+   std::unique_ptr<ParamHistConstraint> newArg{static_cast<ParamHistConstraint *>(Clone())};
+   newArg->_logValueInEval = true;
+   newArg->_normalizeInEval = nNormObs != 0;
+   if (newArg->_normalizeInEval) {
+      for (RooAbsArg *nominal : _nominals) {
+         newArg->_xMins.push_back(static_cast<RooAbsRealLValue *>(nominal)->getMin());
+         newArg->_xMaxs.push_back(static_cast<RooAbsRealLValue *>(nominal)->getMax());
+      }
+   }
+   ctx.markAsCompiled(*newArg);
+   ctx.compileServers(*newArg, {});
+   return newArg;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ParamHistConstraint::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+   // The ranges of the global observables are only needed for the normalization
+   std::string xMins = _normalizeInEval ? ctx.buildArg(std::span<const double>{_xMins}) : "nullptr";
+   std::string xMaxs = _normalizeInEval ? ctx.buildArg(std::span<const double>{_xMaxs}) : "nullptr";
+   std::string logVal = ctx.buildCall("RooFit::Detail::MathFuncs::gammaConstraintsLog", _gammas, _nominals,
+                                      std::span<const double>{_relSigmas}, xMins, xMaxs, _gammas.size(),
+                                      _type == Constraint::Poisson, _normalizeInEval);
+   ctx.addResult(this, _logValueInEval ? logVal : "std::exp(" + logVal + ")");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The integral over all global observables is analytical.
+
+Int_t ParamHistConstraint::getAnalyticalIntegral(RooArgSet &allVars, RooArgSet &analVars, const char * /*rangeName*/) const
+{
+   for (RooAbsArg *nominal : _nominals) {
+      if (!allVars.find(*nominal))
+         return 0;
+   }
+   analVars.add(_nominals);
+   return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double ParamHistConstraint::analyticalIntegral(Int_t code, const char *rangeName) const
+{
+   R__ASSERT(code == 1);
+   return std::exp(logIntegral(rangeName));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Advertise the internal generator for all global observables.
+
+Int_t ParamHistConstraint::getGenerator(const RooArgSet &directVars, RooArgSet &generateVars, bool /*staticInitOK*/) const
+{
+   for (RooAbsArg *nominal : _nominals) {
+      if (!directVars.find(*nominal))
+         return 0;
+   }
+   generateVars.add(_nominals);
+   return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the global observables bin by bin, like RooGaussian and RooPoisson do.
+
+void ParamHistConstraint::generateEvent(Int_t code)
+{
+   R__ASSERT(code == 1);
+   TRandom *rng = RooRandom::randomGenerator();
+   for (std::size_t i = 0; i < _gammas.size(); ++i) {
+      const double gamma = static_cast<RooAbsReal const &>(_gammas[i]).getVal();
+      auto &nominal = static_cast<RooAbsRealLValue &>(_nominals[i]);
+      const double sigma = _relSigmas[i];
+      while (true) {
+         const double xgen =
+            _type == Constraint::Gaussian ? rng->Gaus(gamma, sigma) : rng->Poisson(gamma / (sigma * sigma));
+         if (xgen <= nominal.getMax() && xgen >= nominal.getMin()) {
+            nominal.setVal(xgen);
+            break;
+         }
+      }
+   }
+}
+
+} // namespace HistFactory
+} // namespace RooStats
@@ -11,4 +11,9 @@ def get_argparse():
         help="disable the binned fit optimization used in HistFactory since ROOT 6.28",
         action="store_true",
     )
+    parser.add_argument(
+        "-bulk_gamma_constraints",
+        help="create one constraint term per stat error or shape systematic instead of one per bin",
+        action="store_true",
+    )
     return parser
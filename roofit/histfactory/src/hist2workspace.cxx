@@ -63,6 +63,7 @@ namespace RooStats {
  * -v Switch HistFactory message stream to INFO level.
  * -vv Switch HistFactory message stream to DEBUG level.
  * -disable_binned_fit_optimization Disable the binned fit optimization used in HistFactory since ROOT 6.28.
+ * -bulk_gamma_constraints Create one constraint term per stat error or shape systematic instead of one per bin.
  */
 int main(int argc, char** argv) {
 
@@ -107,6 +108,11 @@ int main(int argc, char** argv) {
       continue;
     }
 
+    if(input == "-bulk_gamma_constraints") {
+      cfg.bulkGammaConstraints = true;
+      continue;
+    }
+
     driverArg = argv[i];
   }
 
@@ -31,7 +31,9 @@
 
 #include "../../roofitcore/test/gtest_wrapper.h"
 
+#include <cmath>
 #include <set>
+#include <string>
 
 namespace {
 
@@ -628,6 +630,154 @@ TEST_P(HFFixture, HS3ClosureLoop)
    EXPECT_TRUE(resultFromJson->isIdentical(*result));
 }
 
+/// Check that the models with one ParamHistConstraint per stat error or shape
+/// systematic have the same likelihood as the models with one constraint pdf
+/// per bin, also when they are imported from or exported to JSON.
+TEST_P(HFFixtureEval, BulkGammaConstraints)
+{
+   using namespace RooFit;
+
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   const MakeModelMode makeModelMode = std::get<0>(GetParam());
+   RooFit::EvalBackend evalBackend = std::get<2>(GetParam());
+
+   RooStats::HistFactory::HistoToWorkspaceFactoryFast::Configuration cfg;
+   cfg.bulkGammaConstraints = true;
+   std::unique_ptr<RooWorkspace> wsBulk{MakeModelAndMeasurementFast(*_measurement, cfg)};
+
+   EXPECT_EQ(ws->pdf("mc_stat_channel1_constraint"), nullptr);
+   EXPECT_NE(ws->pdf("gamma_stat_channel1_bin_0_constraint"), nullptr);
+   EXPECT_NE(wsBulk->pdf("mc_stat_channel1_constraint"), nullptr);
+   EXPECT_EQ(wsBulk->pdf("gamma_stat_channel1_bin_0_constraint"), nullptr);
+
+   // Import the JSON of the model with per-bin constraints as bulk constraints
+   RooWorkspace wsBulkFromJson{"wsBulkFromJson"};
+   RooJSONFactoryWSTool tool{wsBulkFromJson};
+   tool.setBulkGammaConstraints(true);
+   tool.importJSONfromString(RooJSONFactoryWSTool{*ws}.exportJSONtoString());
+   EXPECT_NE(wsBulkFromJson.pdf("mc_stat_channel1_constraint"), nullptr);
+
+   // Export the model with bulk constraints, and import it with per-bin constraints
+   RooWorkspace wsFromBulkJson{"wsFromBulkJson"};
+   RooJSONFactoryWSTool{wsFromBulkJson}.importJSONfromString(RooJSONFactoryWSTool{*wsBulk}.exportJSONtoString());
+   EXPECT_NE(wsFromBulkJson.pdf("gamma_stat_channel1_bin_0_constraint"), nullptr);
+
+   auto createNll = [&](RooWorkspace &w) {
+      auto *mc = dynamic_cast<RooStats::ModelConfig *>(w.obj("ModelConfig"));
+      setInitialFitParameters(w, makeModelMode);
+      // Move the gammas away from the nominal values, so that the constraints contribute
+      for (auto *gamma : {"gamma_stat_channel1_bin_0", "gamma_stat_channel1_bin_1"}) {
+         if (!w.var(gamma)->isConstant())
+            w.var(gamma)->setVal(1.05);
+      }
+      return std::unique_ptr<RooAbsReal>{mc->GetPdf()->createNLL(
+         *w.data("obsData"), GlobalObservables(*mc->GetGlobalObservables()), evalBackend)};
+   };
+
+   std::unique_ptr<RooAbsReal> nll = createNll(*ws);
+   std::unique_ptr<RooAbsReal> nllBulk = createNll(*wsBulk);
+   std::unique_ptr<RooAbsReal> nllBulkFromJson = createNll(wsBulkFromJson);
+   std::unique_ptr<RooAbsReal> nllFromBulkJson = createNll(wsFromBulkJson);
+
+   EXPECT_NEAR(nllBulk->getVal(), nll->getVal(), 1e-9 * std::abs(nll->getVal()));
+   // The uncertainties are rounded in the JSON files
+   EXPECT_NEAR(nllBulkFromJson->getVal(), nll->getVal(), 1e-6 * std::abs(nll->getVal()));
+   EXPECT_NEAR(nllFromBulkJson->getVal(), nll->getVal(), 1e-6 * std::abs(nll->getVal()));
+
+   // If the dataset has global observables, their values are used in the
+   // constraint terms instead of the values in the model, like for toys.
+   auto createNllShiftedGlobs = [&](RooWorkspace &w, std::unique_ptr<RooAbsData> &data) {
+      auto *mc = dynamic_cast<RooStats::ModelConfig *>(w.obj("ModelConfig"));
+      data.reset(static_cast<RooAbsData *>(w.data("obsData")->Clone()));
+      RooArgSet globs;
+      mc->GetGlobalObservables()->snapshot(globs);
+      for (auto *glob : static_range_cast<RooRealVar *>(globs)) {
+         glob->setVal(glob->getVal() * 1.02);
+      }
+      data->setGlobalObservables(globs);
+      return std::unique_ptr<RooAbsReal>{
+         mc->GetPdf()->createNLL(*data, GlobalObservables(*mc->GetGlobalObservables()), evalBackend)};
+   };
+
+   std::unique_ptr<RooAbsData> dataShifted;
+   std::unique_ptr<RooAbsData> dataShiftedBulk;
+   std::unique_ptr<RooAbsReal> nllShifted = createNllShiftedGlobs(*ws, dataShifted);
+   std::unique_ptr<RooAbsReal> nllShiftedBulk = createNllShiftedGlobs(*wsBulk, dataShiftedBulk);
+
+   EXPECT_NE(nllShifted->getVal(), nll->getVal());
+   EXPECT_NEAR(nllShiftedBulk->getVal(), nllShifted->getVal(), 1e-9 * std::abs(nllShifted->getVal()));
+
+   // The model of the fixture has only two bins. The product of the constraint
+   // terms of many bins under- or overflows, while its logarithm is finite.
+   // Check this with a channel with many bins, which doesn't depend on the
+   // fixture parameters apart from the backend.
+   if (makeModelMode != MakeModelMode::ShapeSyst || std::get<1>(GetParam())) {
+      return;
+   }
+
+   // With 5 % Gaussian stat errors, the normalized product overflows after
+   // about 340 bins. With 1 % Poisson shape systematics, it underflows after
+   // about 130 bins.
+   constexpr int nBins = 500;
+   const std::string largeInputFile = "TestBulkGammaLarge.root";
+   {
+      TFile file(largeInputFile.c_str(), "RECREATE");
+      TH1D data("data", "data", nBins, 0, nBins);
+      TH1D bkg("bkg", "bkg", nBins, 0, nBins);
+      TH1D statUnc("bkg_statUncert", "bkg_statUncert", nBins, 0, nBins);
+      TH1D shapeUnc("bkg_shapeSyst", "bkg_shapeSyst", nBins, 0, nBins);
+      for (int bin = 1; bin <= nBins; ++bin) {
+         bkg.SetBinContent(bin, 100.);
+         data.SetBinContent(bin, 100. + (bin % 7) - 3.);
+         statUnc.SetBinContent(bin, 0.05);
+         shapeUnc.SetBinContent(bin, 0.01);
+      }
+      for (TH1D *hist : {&data, &bkg, &statUnc, &shapeUnc}) {
+         file.WriteTObject(hist);
+      }
+   }
+
+   RooStats::HistFactory::Measurement meas("measLarge", "measLarge");
+   meas.SetPOI("mu");
+   meas.AddConstantParam("Lumi");
+   meas.SetLumi(1.0);
+   meas.SetLumiRelErr(0.10);
+   meas.SetExportOnly(true);
+
+   RooStats::HistFactory::Channel chan("channelLarge");
+   chan.SetData("data", largeInputFile);
+   chan.SetStatErrorConfig(0.005, "Gaussian");
+
+   RooStats::HistFactory::Sample bkg("bkg", "bkg", largeInputFile);
+   bkg.AddNormFactor("mu", 1, 0, 3);
+   bkg.ActivateStatError("bkg_statUncert", largeInputFile);
+   bkg.AddShapeSys("bkgShape", RooStats::HistFactory::Constraint::Poisson, "bkg_shapeSyst", largeInputFile);
+   chan.AddSample(bkg);
+   meas.AddChannel(chan);
+   meas.CollectHistograms();
+
+   std::unique_ptr<RooWorkspace> wsLarge{MakeModelAndMeasurementFast(meas)};
+   std::unique_ptr<RooWorkspace> wsLargeBulk{MakeModelAndMeasurementFast(meas, cfg)};
+   EXPECT_NE(wsLargeBulk->pdf("mc_stat_channelLarge_constraint"), nullptr);
+
+   auto createLargeNll = [&](RooWorkspace &w) {
+      auto *mc = dynamic_cast<RooStats::ModelConfig *>(w.obj("ModelConfig"));
+      for (int bin = 0; bin < nBins; ++bin) {
+         w.var(("gamma_stat_channelLarge_bin_" + std::to_string(bin)).c_str())->setVal(1.02);
+         w.var(("gamma_bkgShape_bin_" + std::to_string(bin)).c_str())->setVal(0.99);
+      }
+      return std::unique_ptr<RooAbsReal>{mc->GetPdf()->createNLL(
+         *w.data("obsData"), GlobalObservables(*mc->GetGlobalObservables()), evalBackend)};
+   };
+
+   std::unique_ptr<RooAbsReal> nllLarge = createLargeNll(*wsLarge);
+   std::unique_ptr<RooAbsReal> nllLargeBulk = createLargeNll(*wsLargeBulk);
+
+   ASSERT_TRUE(std::isfinite(nllLarge->getVal()));
+   EXPECT_NEAR(nllLargeBulk->getVal(), nllLarge->getVal(), 1e-9 * std::abs(nllLarge->getVal()));
+}
+
 /// Fit the model to data, and check parameters.
 TEST_P(HFFixtureFit, Fit)
 {
@@ -106,6 +106,12 @@ public:
 
    RooWorkspace *workspace() { return &_workspace; }
 
+   /// Represent the constraint terms of all gamma parameters of a HistFactory
+   /// staterror or shapesys modifier by one ParamHistConstraint, instead of
+   /// one RooPoisson or RooGaussian per bin. Applies to the following imports.
+   void setBulkGammaConstraints(bool flag) { _bulkGammaConstraints = flag; }
+   bool bulkGammaConstraints() const { return _bulkGammaConstraints; }
+
    template <class Obj_t>
    Obj_t &wsImport(Obj_t const &obj)
    {
@@ -224,6 +230,7 @@ private:
    RooFit::Detail::JSONNode *_rootnodeOutput = nullptr;
    RooFit::Detail::JSONNode *_varsNode = nullptr;
    RooWorkspace &_workspace;
+   bool _bulkGammaConstraints = false;
 
    // objects to represent intermediate information
    std::unique_ptr<RooFit::JSONIO::Detail::Domains> _domains;
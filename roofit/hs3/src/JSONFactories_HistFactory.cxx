@@ -15,6 +15,7 @@
 #include <RooFit/Detail/JSONInterface.h>
 
 #include <RooStats/HistFactory/Detail/HistFactoryImpl.h>
+#include <RooStats/HistFactory/ParamHistConstraint.h>
 #include <RooStats/HistFactory/ParamHistFunc.h>
 #include <RooStats/HistFactory/PiecewiseInterpolation.h>
 #include <RooStats/HistFactory/FlexibleInterpVar.h>
@@ -124,9 +125,21 @@ RooAbsPdf *findConstraint(RooAbsArg *g)
    RooLognormal *constraint_l = findClient<RooLognormal>(g);
    if (constraint_l)
       return constraint_l;
+   ParamHistConstraint *constraint_b = findClient<ParamHistConstraint>(g);
+   if (constraint_b)
+      return constraint_b;
    return nullptr;
 }
 
+/// Get the relative uncertainty of a gamma parameter and the class of the
+/// equivalent single-bin constraint from a ParamHistConstraint.
+TClass *bulkConstraintInfo(ParamHistConstraint const &constraint, RooAbsArg const &gamma, double &relSigma)
+{
+   const int idx = constraint.gammas().index(&gamma);
+   relSigma = idx >= 0 ? constraint.relSigmas()[idx] : 0.0;
+   return constraint.constraintType() == Constraint::Poisson ? RooPoisson::Class() : RooGaussian::Class();
+}
+
 std::string toString(TClass *c)
 {
    if (!c) {
@@ -199,8 +212,10 @@ ParamHistFunc &createPHF(const std::string &phfname, std::string const &sysname,
    auto &phf = tool.wsEmplace<ParamHistFunc>(phfname, observables, gammas);
 
    if (constraintType != "Const") {
-      auto constraintsInfo = createGammaConstraints(
-         gammas, vals, minSigma, constraintType == "Poisson" ? Constraint::Poisson : Constraint::Gaussian);
+      const auto type = constraintType == "Poisson" ? Constraint::Poisson : Constraint::Gaussian;
+      auto constraintsInfo = tool.bulkGammaConstraints()
+                                ? createBulkGammaConstraint(phfname + "_constraint", gammas, vals, minSigma, type)
+                                : createGammaConstraints(gammas, vals, minSigma, type);
       for (auto const &term : constraintsInfo.constraints) {
          ws.import(*term, RooFit::RecycleConflictNodes());
          constraints.add(*ws.pdf(term->GetName()));
@@ -807,6 +822,8 @@ bool tryExportHistFactory(RooJSONFactoryWSTool *tool, const std::string &pdfname
                   } else if (RooGaussian *constraint_g = dynamic_cast<RooGaussian *>(constraint)) {
                      double erel = constraint_g->getSigma().getVal() / constraint_g->getMean().getVal();
                      rel_errors[idx] = erel;
+                  } else if (auto constraint_b = dynamic_cast<ParamHistConstraint *>(constraint)) {
+                     sample.barlowBeestonLightConstraint = bulkConstraintInfo(*constraint_b, *g, rel_errors[idx]);
                   } else {
                      RooJSONFactoryWSTool::error(
                         "currently, only RooPoisson and RooGaussian are supported as constraint types");
@@ -838,6 +855,13 @@ bool tryExportHistFactory(RooJSONFactoryWSTool *tool, const std::string &pdfname
                   if (!sys.constraint) {
                      sys.constraint = RooGaussian::Class();
                   }
+               } else if (auto constraint_b = dynamic_cast<ParamHistConstraint *>(constraint)) {
+                  double relSigma = 0.0;
+                  TClass *cl = bulkConstraintInfo(*constraint_b, *g, relSigma);
+                  sys.constraints.push_back(relSigma);
+                  if (!sys.constraint) {
+                     sys.constraint = cl;
+                  }
                }
             }
             sample.shapesys.emplace_back(std::move(sys));
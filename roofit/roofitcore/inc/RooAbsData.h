@@ -81,6 +81,7 @@ public:
 
   void convertToVectorStore() ;
   virtual void convertToTreeStore();
+  void setFloatStorage(bool flag = true);
 
   void attachBuffers(const RooArgSet& extObs) ;
   void resetBuffers() ;
@@ -132,6 +133,7 @@ public:
   using CategorySpans = std::map<RooFit::Detail::DataKey, std::span<const RooAbsCategory::value_type>>;
 
   RealSpans getBatches(std::size_t first = 0, std::size_t len = std::numeric_limits<std::size_t>::max()) const;
+  RealSpans getBatches(std::size_t first, std::size_t len, std::vector<std::vector<double>> &buffers) const;
   CategorySpans getCategoryBatches(std::size_t first = 0, std::size_t len = std::numeric_limits<std::size_t>::max()) const;
 
   ////////////////////////////////////////////////////////////////////////////////
@@ -69,8 +69,9 @@ public:
   }
   virtual bool isWeighted() const = 0 ;
 
-  /// Retrieve batches for all observables in this data store.
-  virtual RooAbsData::RealSpans getBatches(std::size_t first, std::size_t len) const = 0;
+  /// Retrieve batches for all observables in this data store. Columns stored in single precision are converted
+  /// into new vectors appended to `buffers`, which must not be null in that case.
+  virtual RooAbsData::RealSpans getBatches(std::size_t first, std::size_t len, std::vector<std::vector<double>> *buffers) const = 0;
   virtual RooAbsData::CategorySpans getCategoryBatches(std::size_t /*first*/, std::size_t /*len*/) const {
     std::cerr << "This functionality is not yet implemented for this data store." << std::endl;
     throw std::logic_error("getCategoryBatches() not implemented in RooAbsDataStore.");
@@ -266,6 +266,7 @@ public:
                   bool verbose=false, bool autoBinned=true, const char* binnedTag="") const ;
 
   std::unique_ptr<RooAbsArg> compileForNormSet(RooArgSet const &normSet, RooFit::Detail::CompileContext & ctx) const override;
+  virtual std::unique_ptr<RooAbsArg> compileLogValueForNormSet(RooArgSet const &normSet, RooFit::Detail::CompileContext & ctx) const;
 
 private:
 
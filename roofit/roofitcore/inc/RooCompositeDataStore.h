@@ -103,7 +103,7 @@ public:
 
   void forceCacheUpdate() override ;
 
-  RooAbsData::RealSpans getBatches(std::size_t first, std::size_t len) const override {
+  RooAbsData::RealSpans getBatches(std::size_t first, std::size_t len, std::vector<std::vector<double>> * /*buffers*/) const override {
     //TODO
     std::cerr << "This functionality is not yet implemented for composite data stores." << std::endl;
     throw std::logic_error("getBatches() not implemented for RooCompositeDataStore.");
@@ -20,6 +20,8 @@
 #include "RooListProxy.h"
 #include "RooSetProxy.h"
 
+#include <vector>
+
 class RooRealVar;
 class RooArgList ;
 class RooWorkspace ;
@@ -51,9 +53,13 @@ protected:
   RooListProxy _set1 ;    ///< Set of constraint terms
   RooArgSet _paramSet ; ///< Set of parameters to which constraints apply
   const bool _takeGlobalObservablesFromData = false; ///< If the global observable values are taken from data
+  std::vector<bool> _isLogValue; ///<! For each compiled constraint term, if it outputs the logarithm of its value
 
   double evaluate() const override;
 
+private:
+  bool isLogValue(std::size_t i) const;
+
   ClassDefOverride(RooConstraintSum,4) // sum of -log of set of RooAbsPdf representing parameter constraints
 };
 
@@ -215,6 +215,9 @@ public:
                                               const RooAbsCollection &coords, bool reverse = false) const;
   std::string declWeightArrayForCodeSquash(RooAbsArg const *klass, RooFit::Detail::CodeSquashContext &ctx,
                                            bool correctForBinSize) const;
+  std::string interpolateForCodeSquash(RooAbsArg const *klass, RooFit::Detail::CodeSquashContext &ctx,
+                                       std::string const &idxName, const RooAbsCollection &coords, int intOrder,
+                                       bool correctForBinSize, bool cdfBoundaries) const;
 
   protected:
   friend class RooDataHistSliceIter ;
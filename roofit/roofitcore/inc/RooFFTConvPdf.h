@@ -34,7 +34,7 @@ public:
   TObject* clone(const char* newname) const override { return new RooFFTConvPdf(*this,newname); }
   ~RooFFTConvPdf() override ;
 
-  void setShift(double val1, double val2) { _shift1 = val1 ; _shift2 = val2 ; }
+  void setShift(double val1, double val2) { _shift1 = val1 ; _shift2 = val2 ; _cacheMgr.sterilize() ; }
   void setCacheObservables(const RooArgSet& obs) { _cacheObs.removeAll() ; _cacheObs.add(obs) ; }
   const RooArgSet& cacheObservables() const { return _cacheObs ; }
 
@@ -89,6 +89,26 @@ protected:
 
     std::unique_ptr<RooAbsBinning> histBinning;
     std::unique_ptr<RooAbsBinning> scanBinning;
+
+    // Parameters of the input p.d.f.s and their values when the inputs were last sampled, to find out which
+    // input has to be sampled and transformed again
+    RooArgSet params1;
+    RooArgSet params2;
+    std::vector<double> paramValues1;
+    std::vector<double> paramValues2;
+    // Whether the inputs were sampled and transformed at least once. Inputs without parameters are never seen as
+    // changed, so they have to be sampled at the first filling in any case.
+    bool filled1 = false;
+    bool filled2 = false;
+
+    // Forward transforms of the inputs, if the convolution is run in the interpreter
+    std::vector<double> fftOut1;
+    std::vector<double> fftOut2;
+
+    // Number of bins without and with buffer, and position of the zero bin of the first input
+    Int_t N = 0;
+    Int_t N2 = 0;
+    Int_t binShift1 = 0;
   };
 
   friend class FFTCacheElem ;
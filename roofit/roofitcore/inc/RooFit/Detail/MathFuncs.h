@@ -166,6 +166,22 @@ inline unsigned int getUniformBinning(double low, double high, double val, unsig
    return val >= high ? numBins - 1 : std::abs((val - low) / binWidth);
 }
 
+/// @brief Polynomial interpolation through the n points (xa[i], ya[i]), written in Lagrange form.
+/// This gives the same result as RooMath::interpolate(), but it is simpler to differentiate.
+inline double interpolate(double const *xa, double const *ya, int n, double x)
+{
+   double res = 0.0;
+   for (int i = 0; i < n; ++i) {
+      double term = ya[i];
+      for (int j = 0; j < n; ++j) {
+         if (j != i)
+            term *= (x - xa[j]) / (xa[i] - xa[j]);
+      }
+      res += term;
+   }
+   return res;
+}
+
 inline double poisson(double x, double par)
 {
    if (par < 0)
@@ -285,12 +301,12 @@ inline double flexibleInterpSingle(unsigned int code, double low, double high, d
    return 0.0;
 }
 
-inline double flexibleInterp(unsigned int code, double *params, unsigned int n, double *low, double *high,
+inline double flexibleInterp(int const *codes, double *params, unsigned int n, double *low, double *high,
                              double boundary, double nominal, int doCutoff)
 {
    double total = nominal;
    for (std::size_t i = 0; i < n; ++i) {
-      total += flexibleInterpSingle(code, low[i], high[i], boundary, nominal, params[i], total);
+      total += flexibleInterpSingle(codes[i], low[i], high[i], boundary, nominal, params[i], total);
    }
 
    return doCutoff && total <= 0 ? TMath::Limits<double>::Min() : total;
@@ -603,6 +619,51 @@ poissonIntegral(int code, double mu, double x, double integrandMin, double integ
    return ROOT::Math::gamma_cdf(integrandMax, ix, 1.0) - ROOT::Math::gamma_cdf(integrandMin, ix, 1.0);
 }
 
+/// Logarithm of the constraint term of a gamma parameter, see RooStats::HistFactory::ParamHistConstraint. For
+/// Gaussian constraints, it is an unnormalized Gaussian of the global observable with mean gamma and width sigma.
+/// For Poisson constraints, it is a Poisson of the global observable, without rounding, with mean gamma / sigma^2.
+inline double gammaConstraintLog(double gamma, double nominal, double sigma, unsigned int poissonType)
+{
+   if (!poissonType) {
+      const double arg = (nominal - gamma) / sigma;
+      return -0.5 * arg * arg;
+   }
+
+   const double mean = gamma / (sigma * sigma);
+   if (mean < 0)
+      return TMath::QuietNaN();
+   if (nominal < 0)
+      return -std::numeric_limits<double>::infinity();
+   if (nominal == 0.0)
+      return -mean;
+   return nominal * std::log(mean) - TMath::LnGamma(nominal + 1.) - mean;
+}
+
+/// Logarithm of the integral of gammaConstraintLog() over the global observable in [xMin, xMax].
+inline double gammaConstraintLogIntegral(double gamma, double sigma, double xMin, double xMax, unsigned int poissonType)
+{
+   if (!poissonType) {
+      return std::log(gaussianIntegral(xMin, xMax, gamma, sigma));
+   }
+   return std::log(poissonIntegral(1, gamma / (sigma * sigma), 0., xMin, xMax, false));
+}
+
+/// Logarithm of the product of the constraint terms of n gamma parameters, see gammaConstraintLog(). If normalize is
+/// set, each term is normalized over the range [xMin[i], xMax[i]] of its global observable.
+inline double gammaConstraintsLog(double const *gammas, double const *nominals, double const *sigmas,
+                                  double const *xMin, double const *xMax, unsigned int n, unsigned int poissonType,
+                                  unsigned int normalize)
+{
+   double out = 0.0;
+   for (unsigned int i = 0; i < n; ++i) {
+      out += gammaConstraintLog(gammas[i], nominals[i], sigmas[i], poissonType);
+      if (normalize) {
+         out -= gammaConstraintLogIntegral(gammas[i], sigmas[i], xMin[i], xMax[i], poissonType);
+      }
+   }
+   return out;
+}
+
 inline double logNormalIntegral(double xMin, double xMax, double m0, double k)
 {
    const double root2 = std::sqrt(2.);
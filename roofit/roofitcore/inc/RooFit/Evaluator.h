@@ -56,6 +56,10 @@ private:
    void markGPUNodes();
    void assignToGPU(NodeInfo &info);
    void computeCPUNode(const RooAbsArg *node, NodeInfo &info);
+   std::span<double> prepareCPUOutput(const RooAbsArg *node, NodeInfo &info);
+   static void evaluateCPUNode(const RooAbsArg *node, RooFit::EvalContext &ctx, std::span<double> output);
+   void runIMT();
+   void markConcurrentNodes();
    void setOperMode(RooAbsArg *arg, RooAbsArg::OperMode opMode);
    void syncDataTokens();
    void updateOutputSizes();
@@ -63,10 +67,12 @@ private:
    std::unique_ptr<Detail::BufferManager> _bufferManager;
    RooAbsReal &_topNode;
    const bool _useGPU = false;
+   bool _useIMT = false;
    int _nEvaluations = 0;
    bool _needToUpdateOutputSizes = false;
    RooFit::EvalContext _evalContextCPU;
    RooFit::EvalContext _evalContextCUDA;
+   std::vector<RooFit::EvalContext> _evalContextsIMT; // one evaluation context per concurrent task
    std::vector<NodeInfo> _nodes; // the ordered computation graph
    std::stack<std::unique_ptr<ChangeOperModeRAII>> _changeOperModeRAIIs;
 };
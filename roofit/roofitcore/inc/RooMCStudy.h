@@ -99,6 +99,8 @@ protected:
   RooPlot* makeFrameAndPlotCmd(const RooRealVar& param, RooLinkedList& cmdList, bool symRange=false) const ;
 
   bool run(bool generate, bool fit, Int_t nSamples, Int_t nEvtPerSample, bool keepGenData, const char* asciiFilePat) ;
+  void runSample(bool generate, bool fit, Int_t nSamples, Int_t nEvtPerSample, bool keepGenData, const char* asciiFilePat) ;
+  void runParallel(bool generate, bool fit, Int_t nSamples, Int_t nEvtPerSample, bool keepGenData, const char* asciiFilePat) ;
   bool fitSample(RooAbsData* genSample) ;
   RooFit::OwningPtr<RooFitResult> doFit(RooAbsData* genSample) ;
 
@@ -137,6 +139,7 @@ protected:
   bool      _verboseGen       ; ///< Verbose generation?
   bool      _perExptGenParams = false; ///< Do generation parameter change per event?
   bool      _silence          ; ///< Silent running mode?
+  int       _nWorkers = 1     ; ///< Number of worker processes
 
   std::list<RooAbsMCStudyModule*> _modList ; ///< List of additional study modules ;
 
@@ -73,7 +73,7 @@ public:
   void weightError(double& lo, double& hi, RooAbsData::ErrorType etype=RooAbsData::Poisson) const override ;
   bool isWeighted() const override { return (_wgtVar!=nullptr||_extWgtArray!=nullptr) ; }
 
-  RooAbsData::RealSpans getBatches(std::size_t first, std::size_t len) const override {
+  RooAbsData::RealSpans getBatches(std::size_t first, std::size_t len, std::vector<std::vector<double>> * /*buffers*/) const override {
     //TODO
     std::cerr << "This functionality is not yet implemented for tree data stores." << std::endl;
     throw std::logic_error("getBatches() not implemented in RooTreeDataStore.");
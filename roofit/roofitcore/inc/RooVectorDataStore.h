@@ -28,6 +28,8 @@
 #include <list>
 #include <vector>
 #include <algorithm>
+#include <stdexcept>
+#include <string>
 
 class RooAbsArg ;
 class RooArgList ;
@@ -78,6 +80,8 @@ public:
 
     std::vector<ArrayInfo<double>> reals;
     std::vector<ArrayInfo<RooAbsCategory::value_type>> cats;
+    /// Columns stored in single precision, converted to double precision. The corresponding reals point into them.
+    std::vector<std::vector<double>> buffers;
 
     std::size_t size;
   };
@@ -121,7 +125,7 @@ public:
   void weightError(double& lo, double& hi, RooAbsData::ErrorType etype=RooAbsData::Poisson) const override;
   bool isWeighted() const override { return _wgtVar || _extWgtArray; }
 
-  RooAbsData::RealSpans getBatches(std::size_t first, std::size_t len) const override;
+  RooAbsData::RealSpans getBatches(std::size_t first, std::size_t len, std::vector<std::vector<double>> *buffers) const override;
   RooAbsData::CategorySpans getCategoryBatches(std::size_t /*first*/, std::size_t len) const override;
   std::span<const double> getWeightBatch(std::size_t first, std::size_t len) const override;
 
@@ -209,7 +213,8 @@ public:
     }
 
     RealVector(const RealVector& other, RooAbsReal* real=nullptr) :
-      _vec(other._vec), _nativeReal(real?real:other._nativeReal), _real(real?real:other._real), _buf(other._buf), _nativeBuf(other._nativeBuf) {
+      _vec(other._vec), _vecF(other._vecF), _floatStorage(other._floatStorage),
+      _nativeReal(real?real:other._nativeReal), _real(real?real:other._real), _buf(other._buf), _nativeBuf(other._nativeBuf) {
       if (other._tracker) {
         _tracker = new RooChangeTracker(Form("track_%s",_nativeReal->GetName()),"tracker",other._tracker->parameters()) ;
       } else {
@@ -226,6 +231,8 @@ public:
       _real = other._real;
       _buf = other._buf;
       _nativeBuf = other._nativeBuf;
+      _floatStorage = other._floatStorage;
+      _vecF = other._vecF;
       if (other._vec.size() <= _vec.capacity() / 2 && _vec.capacity() > (VECTOR_BUFFER_SIZE / sizeof(double))) {
         std::vector<double> tmp;
         tmp.reserve(std::max(other._vec.size(), VECTOR_BUFFER_SIZE / sizeof(double)));
@@ -269,36 +276,80 @@ public:
       return _tracker->hasChanged(true) ;
     }
 
+    /// Store the values in single precision, which halves the memory used by this column.
+    /// The values are converted back to double precision when they are loaded or requested with getRange(first, last, buffer).
+    void setFloatStorage(bool flag) {
+      if (flag == _floatStorage) return;
+      if (flag) {
+        _vecF.assign(_vec.begin(), _vec.end());
+        std::vector<double>().swap(_vec);
+      } else {
+        _vec.assign(_vecF.begin(), _vecF.end());
+        std::vector<float>().swap(_vecF);
+      }
+      _floatStorage = flag;
+    }
+
+    bool isFloatStorage() const { return _floatStorage; }
+
     void fill() {
-      _vec.push_back(*_buf);
+      if (_floatStorage) {
+        _vecF.push_back(*_buf);
+      } else {
+        _vec.push_back(*_buf);
+      }
     }
 
     void write(Int_t i) {
-      assert(static_cast<std::size_t>(i) < _vec.size());
-      _vec[i] = *_buf ;
+      assert(static_cast<std::size_t>(i) < size());
+      if (_floatStorage) {
+        _vecF[i] = *_buf ;
+      } else {
+        _vec[i] = *_buf ;
+      }
     }
 
     void reset() {
       _vec.clear();
+      _vecF.clear();
     }
 
     inline void load(std::size_t idx) const {
-      assert(idx < _vec.size());
-      *_buf = *(_vec.begin() + idx) ;
+      assert(idx < size());
+      *_buf = _floatStorage ? _vecF[idx] : *(_vec.begin() + idx) ;
       *_nativeBuf = *_buf ;
     }
 
+    /// Return the values in [first, last). With single-precision storage, the values are converted into `buffer`,
+    /// which has to outlive the returned span.
+    std::span<const double> getRange(std::size_t first, std::size_t last, std::vector<double>& buffer) const {
+      if (!_floatStorage) return getRange(first, last);
+
+      auto beg = std::min(_vecF.cbegin() + first, _vecF.cend());
+      auto end = std::min(_vecF.cbegin() + last,  _vecF.cend());
+      buffer.assign(beg, end);
+      return std::span<const double>(buffer.data(), buffer.size());
+    }
+
+    /// Return the values in [first, last), which have to be stored in double precision.
     std::span<const double> getRange(std::size_t first, std::size_t last) const {
+      if (_floatStorage) {
+        throw std::logic_error("RealVector::getRange(): the values of " + std::string(_nativeReal->GetName()) +
+                               " are stored in single precision, a buffer for the conversion is needed.");
+      }
+
       auto beg = std::min(_vec.cbegin() + first, _vec.cend());
       auto end = std::min(_vec.cbegin() + last,  _vec.cend());
 
       return std::span<const double>(&*beg, std::distance(beg, end));
     }
 
-    std::size_t size() const { return _vec.size() ; }
+    std::size_t size() const { return _floatStorage ? _vecF.size() : _vec.size() ; }
 
     void resize(Int_t newSize) {
-      if (newSize < Int_t(_vec.capacity()) / 2 && _vec.capacity() > (VECTOR_BUFFER_SIZE / sizeof(double))) {
+      if (_floatStorage) {
+        _vecF.resize(newSize);
+      } else if (newSize < Int_t(_vec.capacity()) / 2 && _vec.capacity() > (VECTOR_BUFFER_SIZE / sizeof(double))) {
         // do an expensive copy, if we save at least a factor 2 in size
         std::vector<double> tmp;
         tmp.reserve(std::max(newSize, Int_t(VECTOR_BUFFER_SIZE / sizeof(double))));
@@ -313,9 +364,14 @@ public:
     }
 
     void reserve(Int_t newSize) {
-      _vec.reserve(newSize);
+      if (_floatStorage) {
+        _vecF.reserve(newSize);
+      } else {
+        _vec.reserve(newSize);
+      }
     }
 
+    /// Direct access to the values stored in double precision, which is empty if isFloatStorage() is true.
     const std::vector<double>& data() const {
       return _vec;
     }
@@ -324,6 +380,8 @@ public:
 
   protected:
     std::vector<double> _vec;
+    std::vector<float> _vecF;              ///< Values, if stored in single precision
+    bool _floatStorage = false;            ///< Whether the values are stored in _vecF instead of _vec
 
   private:
     friend class RooVectorDataStore ;
@@ -333,7 +391,7 @@ public:
     double* _nativeBuf = nullptr; ///<!
     RooChangeTracker* _tracker = nullptr;
     RooArgSet* _nset = nullptr; ///<!
-    ClassDef(RealVector,1) // STL-vector-based Data Storage class
+    ClassDef(RealVector,2) // STL-vector-based Data Storage class
   } ;
 
 
@@ -541,6 +599,10 @@ public:
   std::vector<RealFullVector*>& realfStoreList() { return _realfStoreList ; }
   std::vector<CatVector*>& catStoreList() { return _catStoreList ; }
 
+  void setFloatStorage(bool flag);
+  /// Whether the real-valued observables are stored in single precision.
+  bool isFloatStorage() const { return _floatStorage; }
+
  protected:
 
   friend class RooAbsReal ;
@@ -588,7 +650,9 @@ public:
 
   bool _forcedUpdate = false; ///<! Request for forced cache update
 
-  ClassDefOverride(RooVectorDataStore, 7) // STL-vector-based Data Storage class
+  bool _floatStorage = false; ///< Store the real-valued observables, except the weight, in single precision
+
+  ClassDefOverride(RooVectorDataStore, 8) // STL-vector-based Data Storage class
 };
 
 
@@ -98,8 +98,10 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
    }
 
    // Get the real-valued batches and cast the also to double branches to put in
-   // the data map
-   for (auto const &item : data.getBatches(0, nEvents)) {
+   // the data map. The columns stored in single precision are converted into
+   // temporary buffers, which are released once they are copied.
+   std::vector<std::vector<double>> conversionBuffers;
+   for (auto const &item : data.getBatches(0, nEvents, conversionBuffers)) {
 
       std::span<const double> span{item.second};
 
@@ -114,6 +116,7 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
       }
       insert(item.first->GetName(), {buffer.data(), buffer.size()});
    }
+   conversionBuffers.clear();
 
    // Get the category batches and cast the also to double branches to put in
    // the data map
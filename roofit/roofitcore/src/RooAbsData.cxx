@@ -298,6 +298,25 @@ void RooAbsData::convertToVectorStore()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Store the values of the real-valued observables in single precision, which halves the memory used by
+/// large unbinned datasets. The weights are always stored in double precision. Tree-based storage is converted
+/// to vector-based storage first. The values are converted back to double precision when they are read, so
+/// this only changes the results by the rounding of the stored values to single precision.
+/// \note This is not supported for datasets with composite storage.
+/// \param[in] flag Use single-precision (true) or double-precision (false) storage.
+
+void RooAbsData::setFloatStorage(bool flag)
+{
+   convertToVectorStore();
+   if (auto vectorStore = dynamic_cast<RooVectorDataStore*>(_dstore.get())) {
+      vectorStore->setFloatStorage(flag);
+   } else {
+      coutW(DataHandling) << "RooAbsData::setFloatStorage(" << GetName()
+                          << ") single-precision storage is only supported for vector-based storage" << std::endl;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 bool RooAbsData::changeObservableName(const char* from, const char* to)
@@ -2536,7 +2555,21 @@ double RooAbsData::sumEntriesW2() const {
 /// \param begin Index of first event that ends up in the batch.
 /// \param len   Number of events in each batch.
 RooAbsData::RealSpans RooAbsData::getBatches(std::size_t begin, std::size_t len) const {
-  return store()->getBatches(begin, len);
+  return store()->getBatches(begin, len, nullptr);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write information to retrieve data columns into `evalData.spans`, also for
+/// columns that are stored in single precision (see RooAbsData::setFloatStorage()).
+/// These columns are converted to double precision into new vectors appended to
+/// `buffers`, which have to outlive the returned spans. Nothing is kept in the
+/// dataset, so the memory is released together with the buffers.
+/// \param begin Index of first event that ends up in the batch.
+/// \param len   Number of events in each batch.
+/// \param buffers Buffers for the converted columns.
+RooAbsData::RealSpans RooAbsData::getBatches(std::size_t begin, std::size_t len, std::vector<std::vector<double>> &buffers) const {
+  return store()->getBatches(begin, len, &buffers);
 }
 
 
@@ -2801,6 +2801,22 @@ RooAbsPdf::compileForNormSet(RooArgSet const &normSet, RooFit::Detail::CompileCo
    return newArg;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compile this pdf into a node of the computation graph whose output is the
+/// logarithm of the pdf normalized over `normSet`. This is used by
+/// RooConstraintSum, for pdfs whose value can under- or overflow although its
+/// logarithm is finite, like products of many constraint terms.
+/// The default implementation returns a `nullptr`, in which case the pdf is
+/// compiled with compileForNormSet() and the logarithm is taken of its value.
+/// \param[in] normSet The normalization set.
+/// \param[in] ctx The compile context.
+
+std::unique_ptr<RooAbsArg>
+RooAbsPdf::compileLogValueForNormSet(RooArgSet const & /*normSet*/, RooFit::Detail::CompileContext & /*ctx*/) const
+{
+   return nullptr;
+}
+
 /// Returns an object that represents the expected number of events for a given
 /// normalization set, similar to how createIntegral() returns an object that
 /// returns the integral. This is used to build the computation graph for the
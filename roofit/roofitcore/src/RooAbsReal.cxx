@@ -100,11 +100,21 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <sys/types.h>
 
 namespace {
 
+// The evaluation error log is shared by all RooAbsReals. It is protected by a
+// mutex, because the RooFit::Evaluator can evaluate independent nodes
+// concurrently if implicit multi-threading is enabled.
+std::recursive_mutex &evalErrorMutex()
+{
+   static std::recursive_mutex mutex;
+   return mutex;
+}
+
 // Internal helper RooAbsFunc that evaluates the scaled data-weighted average of
 // given RooAbsReal as a function of a single variable using the RooFit::Evaluator.
 class ScaledDataWeightedAverage : public RooAbsFunc {
@@ -3493,6 +3503,8 @@ void RooAbsReal::logEvalError(const RooAbsReal* originator, const char* origName
     return ;
   }
 
+  std::lock_guard<std::recursive_mutex> lock(evalErrorMutex());
+
   if (_evalErrorMode==CountErrors) {
     _evalErrorCount++ ;
     return ;
@@ -3548,6 +3560,8 @@ void RooAbsReal::logEvalError(const char* message, const char* serverValueString
     return ;
   }
 
+  std::lock_guard<std::recursive_mutex> lock(evalErrorMutex());
+
   if (_evalErrorMode==CountErrors) {
     _evalErrorCount++ ;
     return ;
@@ -37,6 +37,10 @@ arguments.
 #include "RooHelpers.h"
 #include "RooAbsCategoryLValue.h"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
 ClassImp(RooConstraintSum);
 
 
@@ -60,7 +64,8 @@ RooConstraintSum::RooConstraintSum(const RooConstraintSum& other, const char* na
   RooAbsReal(other, name),
   _set1("set1",this,other._set1),
   _paramSet(other._paramSet),
-  _takeGlobalObservablesFromData{other._takeGlobalObservablesFromData}
+  _takeGlobalObservablesFromData{other._takeGlobalObservablesFromData},
+  _isLogValue(other._isLogValue)
 {
 }
 
@@ -79,30 +84,69 @@ double RooConstraintSum::evaluate() const
   return sum;
 }
 
+/// Whether the i-th constraint term was compiled into a node that outputs its logarithm.
+bool RooConstraintSum::isLogValue(std::size_t i) const
+{
+   return i < _isLogValue.size() && _isLogValue[i];
+}
+
 void RooConstraintSum::translate(RooFit::Detail::CodeSquashContext &ctx) const
 {
-   ctx.addResult(this, ctx.buildCall("RooFit::Detail::MathFuncs::constraintSum", _set1, _set1.size()));
+   RooArgList terms;
+   std::string result;
+   for (std::size_t i = 0; i < _set1.size(); ++i) {
+      if (isLogValue(i)) {
+         result += " - " + ctx.getResult(_set1[i]);
+      } else {
+         terms.add(_set1[i]);
+      }
+   }
+   if (terms.empty()) {
+      result = "0.0" + result;
+   } else {
+      result = ctx.buildCall("RooFit::Detail::MathFuncs::constraintSum", terms, terms.size()) + result;
+   }
+   ctx.addResult(this, result);
 }
 
 void RooConstraintSum::doEval(RooFit::EvalContext &ctx) const
 {
    double sum(0);
 
-   for (const auto comp : _set1) {
-      sum -= std::log(ctx.at(comp)[0]);
+   for (std::size_t i = 0; i < _set1.size(); ++i) {
+      const double val = ctx.at(&_set1[i])[0];
+      sum -= isLogValue(i) ? val : std::log(val);
    }
 
    ctx.output()[0] = sum;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compile the constraint terms for the normalization over their global
+/// observables. The terms that support it are compiled into nodes that output
+/// the logarithm of their normalized value, see RooAbsPdf::compileLogValueForNormSet().
+
 std::unique_ptr<RooAbsArg> RooConstraintSum::compileForNormSet(RooArgSet const & /*normSet*/, RooFit::Detail::CompileContext & ctx) const
 {
-   std::unique_ptr<RooAbsReal> newArg{static_cast<RooAbsReal*>(this->Clone())};
+   std::unique_ptr<RooConstraintSum> newArg{static_cast<RooConstraintSum*>(this->Clone())};
 
-   for (const auto server : newArg->servers()) {
+   std::vector<RooAbsArg *> logValueTerms;
+   std::vector<RooAbsArg *> servers(newArg->servers().begin(), newArg->servers().end());
+   for (const auto server : servers) {
       RooArgSet nset;
       server->getObservables(&_paramSet, nset);
-      ctx.compileServer(*server, *newArg, nset);
+      if (std::unique_ptr<RooAbsArg> logValue = static_cast<RooAbsPdf *>(server)->compileLogValueForNormSet(nset, ctx)) {
+         newArg->redirectServers(std::unordered_map<RooAbsArg *, RooAbsArg *>{{server, logValue.get()}});
+         logValueTerms.push_back(logValue.get());
+         newArg->addOwnedComponents(std::move(logValue));
+      } else {
+         ctx.compileServer(*server, *newArg, nset);
+      }
+   }
+
+   newArg->_isLogValue.clear();
+   for (const auto comp : newArg->_set1) {
+      newArg->_isLogValue.push_back(std::find(logValueTerms.begin(), logValueTerms.end(), comp) != logValueTerms.end());
    }
 
    return newArg;
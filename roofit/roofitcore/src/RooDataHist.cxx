@@ -54,6 +54,7 @@ See RooAbsData::plotOn().
 #include "RooBinning.h"
 #include "RooPlot.h"
 #include "RooHistError.h"
+#include "RooNumber.h"
 #include "RooCategory.h"
 #include "RooCmdConfig.h"
 #include "RooLinkedListIter.h"
@@ -1050,6 +1051,77 @@ std::string RooDataHist::calculateTreeIndexForCodeSquash(RooAbsArg const *klass,
    return idxName;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the code for the interpolated weight at the coordinates `coords`,
+/// mirroring what weightFast() computes for `intOrder > 0`. For each bin and
+/// for both sides of the bin center, the `intOrder + 1` interpolation points are
+/// tabulated once, so the generated code only needs to select the right set of
+/// points and evaluate the interpolating polynomial. Only one-dimensional,
+/// uniformly binned histograms are supported.
+/// \param[in] klass The function or pdf for which the code is generated.
+/// \param[in] ctx The code squashing context.
+/// \param[in] idxName Name of the variable holding the bin index, as returned
+///                    by calculateTreeIndexForCodeSquash().
+/// \param[in] coords Variables that are representing the coordinates.
+/// \param[in] intOrder Interpolation order.
+/// \param[in] correctForBinSize Enable the inverse bin volume correction factor.
+/// \param[in] cdfBoundaries Enable the special boundary condition for a cdf.
+std::string RooDataHist::interpolateForCodeSquash(RooAbsArg const *klass, RooFit::Detail::CodeSquashContext &ctx,
+                                                  std::string const &idxName, const RooAbsCollection &coords,
+                                                  int intOrder, bool correctForBinSize, bool cdfBoundaries) const
+{
+   if (_vars.size() != 1) {
+      coutE(InputArguments) << "RooHistPdf::weight(" << GetName()
+                            << ") ERROR: Code Squashing currently only supports interpolation in one dimension."
+                            << std::endl;
+      return "";
+   }
+
+   // The index calculation already made sure that the binning is uniform
+   const RooAbsBinning &binning = *_lvbins[0];
+   const int nBins = binning.numBins();
+   const int n = intOrder + 1;
+
+   // Interpolation points for each bin, first for values above and then for
+   // values below the bin center, following interpolateDim().
+   std::vector<double> xarr(2 * nBins * n);
+   std::vector<double> yarr(2 * nBins * n);
+   auto binWeight = [&](int ibin) { return correctForBinSize ? _wgt[ibin] / _binv[ibin] : _wgt[ibin]; };
+   for (int fbinC = 0; fbinC < nBins; ++fbinC) {
+      for (int below = 0; below < 2; ++below) {
+         const int fbinLo = fbinC - intOrder / 2 - below;
+         double *x = xarr.data() + (2 * fbinC + below) * n;
+         double *y = yarr.data() + (2 * fbinC + below) * n;
+         for (int i = fbinLo; i <= intOrder + fbinLo; i++) {
+            if (i >= 0 && i < nBins) {
+               x[i - fbinLo] = binning.binCenter(i);
+               y[i - fbinLo] = binWeight(i);
+            } else if (i >= nBins) {
+               const int ibin = 2 * nBins - i - 1;
+               x[i - fbinLo] = cdfBoundaries ? binning.highBound() + 1e-10 * (i - nBins + 1)
+                                             : 2 * binning.highBound() - binning.binCenter(ibin);
+               y[i - fbinLo] = cdfBoundaries ? 1.0 : binWeight(ibin);
+            } else {
+               const int ibin = -i - 1;
+               x[i - fbinLo] = cdfBoundaries ? binning.lowBound() - ibin * (1e-10)
+                                             : 2 * binning.lowBound() - binning.binCenter(ibin);
+               y[i - fbinLo] = cdfBoundaries ? 0.0 : binWeight(ibin);
+            }
+         }
+      }
+   }
+
+   std::string xName = ctx.getResult(*coords[0]);
+   std::string offsetName = ctx.getTmpVarName();
+   const double binWidth = (binning.highBound() - binning.lowBound()) / nBins;
+   ctx.addToCodeBody(klass, "unsigned int " + offsetName + " = " + std::to_string(n) + " * (2 * " + idxName + " + (" +
+                               xName + " < " + RooNumber::toString(binning.lowBound()) + " + (" + idxName +
+                               " + 0.5) * " + RooNumber::toString(binWidth) + "));\n");
+
+   return ctx.buildCall("RooFit::Detail::MathFuncs::interpolate", ctx.buildArg(xarr) + " + " + offsetName,
+                        ctx.buildArg(yarr) + " + " + offsetName, n, xName);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Calculate the bin index corresponding to the coordinates passed as argument.
 /// \param[in] coords Coordinates. If `fast == false`, these can be partial.
@@ -110,6 +110,7 @@
 
 #include "RooFFTConvPdf.h"
 
+#include "RooAbsCategory.h"
 #include "RooAbsReal.h"
 #include "RooMsgService.h"
 #include "RooDataHist.h"
@@ -138,7 +139,7 @@ namespace {
 
 auto declareDoFFT()
 {
-   static void (*doFFT)(int, double *, double *, double *) = nullptr;
+   static void (*doFFT)(int, double *, double *, double *, double *, double *) = nullptr;
 
    if (doFFT)
       return doFFT;
@@ -159,19 +160,50 @@ auto declareDoFFT()
    }
 
    gInterpreter->Declare(R"(
-void RooFFTConvPdf_doFFT(int n, double *input1, double *input2, double *output)
+#include <map>
+#include <mutex>
+
+struct RooFFTConvPdf_Plans {
+   fftw_plan r2c;
+   fftw_plan c2r;
+};
+
+// The plans are created only once for each transform size, because planning is much slower than executing
+// the transform. Creating a plan is not thread safe, while executing it with new arrays is.
+RooFFTConvPdf_Plans const &RooFFTConvPdf_getPlans(int n)
 {
-   auto fftr2c1_Out = reinterpret_cast<fftw_complex *>(fftw_malloc(sizeof(fftw_complex) * (n / 2 + 1)));
-   auto fftr2c2_Out = reinterpret_cast<fftw_complex *>(fftw_malloc(sizeof(fftw_complex) * (n / 2 + 1)));
-   auto fftc2r_In = reinterpret_cast<fftw_complex *>(fftw_malloc(sizeof(fftw_complex) * (n / 2 + 1)));
+   static std::mutex mutex;
+   static std::map<int, RooFFTConvPdf_Plans> plansMap;
+
+   std::lock_guard<std::mutex> lock(mutex);
+   auto found = plansMap.find(n);
+   if (found != plansMap.end())
+      return found->second;
+
+   auto in = reinterpret_cast<double *>(fftw_malloc(sizeof(double) * n));
+   auto out = reinterpret_cast<fftw_complex *>(fftw_malloc(sizeof(fftw_complex) * (n / 2 + 1)));
+   RooFFTConvPdf_Plans &plans = plansMap[n];
+   plans.r2c = fftw_plan_dft_r2c_1d(n, in, out, FFTW_ESTIMATE | FFTW_UNALIGNED);
+   plans.c2r = fftw_plan_dft_c2r_1d(n, out, in, FFTW_ESTIMATE | FFTW_UNALIGNED);
+   fftw_free(in);
+   fftw_free(out);
+   return plans;
+}
 
-   fftw_plan fftr2c1_plan = fftw_plan_dft_r2c(1, &n, input1, fftr2c1_Out, FFTW_ESTIMATE);
-   fftw_plan fftr2c2_plan = fftw_plan_dft_r2c(1, &n, input2, fftr2c2_Out, FFTW_ESTIMATE);
-   fftw_plan fftc2r_plan = fftw_plan_dft_c2r(1, &n, fftc2r_In, output, FFTW_ESTIMATE);
+// The forward transforms are written to fft1 and fft2 (n / 2 + 1 complex numbers each). If an input is a null
+// pointer, its transform from the previous call is used.
+void RooFFTConvPdf_doFFT(int n, double *input1, double *input2, double *fft1, double *fft2, double *output)
+{
+   auto const &plans = RooFFTConvPdf_getPlans(n);
+   auto fftr2c1_Out = reinterpret_cast<fftw_complex *>(fft1);
+   auto fftr2c2_Out = reinterpret_cast<fftw_complex *>(fft2);
+   auto fftc2r_In = reinterpret_cast<fftw_complex *>(fftw_malloc(sizeof(fftw_complex) * (n / 2 + 1)));
 
    // Real->Complex FFT Transform on p.d.f. samplings
-   fftw_execute(fftr2c1_plan);
-   fftw_execute(fftr2c2_plan);
+   if (input1)
+      fftw_execute_dft_r2c(plans.r2c, input1, fftr2c1_Out);
+   if (input2)
+      fftw_execute_dft_r2c(plans.r2c, input2, fftr2c2_Out);
 
    // Loop over first half +1 of complex output results, multiply
    // and set as input of reverse transform
@@ -185,19 +217,14 @@ void RooFFTConvPdf_doFFT(int n, double *input1, double *input2, double *output)
    }
 
    // Reverse Complex->Real FFT transform product
-   fftw_execute(fftc2r_plan);
-
-   fftw_destroy_plan(fftr2c1_plan);
-   fftw_destroy_plan(fftr2c2_plan);
-   fftw_destroy_plan(fftc2r_plan);
+   fftw_execute_dft_c2r(plans.c2r, fftc2r_In, output);
 
-   fftw_free(fftr2c1_Out);
-   fftw_free(fftr2c2_Out);
    fftw_free(fftc2r_In);
 }
 )");
 
-   doFFT = reinterpret_cast<void(*)(int, double*, double*, double*)>(gInterpreter->ProcessLine("RooFFTConvPdf_doFFT;"));
+   doFFT = reinterpret_cast<void (*)(int, double *, double *, double *, double *, double *)>(
+      gInterpreter->ProcessLine("RooFFTConvPdf_doFFT;"));
    return doFFT;
 }
 
@@ -205,6 +232,30 @@ void RooFFTConvPdf_doFFT(int n, double *input1, double *input2, double *output)
 
 #endif
 
+namespace {
+
+// Check if the values of the parameters are different from the stored values, and store the new values.
+bool parametersChanged(RooArgSet const &params, std::vector<double> &values)
+{
+   bool changed = values.size() != params.size();
+   values.resize(params.size());
+   for (std::size_t i = 0; i < params.size(); ++i) {
+      double val = 0.0;
+      if (auto real = dynamic_cast<RooAbsReal const *>(params[i])) {
+         val = real->getVal();
+      } else if (auto cat = dynamic_cast<RooAbsCategory const *>(params[i])) {
+         val = cat->getCurrentIndex();
+      }
+      if (val != values[i]) {
+         values[i] = val;
+         changed = true;
+      }
+   }
+   return changed;
+}
+
+} // namespace
+
 using std::endl, std::string, std::ostream;
 
 ClassImp(RooFFTConvPdf);
@@ -411,6 +462,8 @@ RooFFTConvPdf::FFTCacheElem::FFTCacheElem(const RooFFTConvPdf& self, const RooAr
 
   pdf1Clone->recursiveRedirectServers(fftParams) ;
   pdf2Clone->recursiveRedirectServers(fftParams) ;
+  pdf1Clone->getParameters(hist()->get(), params1) ;
+  pdf2Clone->getParameters(hist()->get(), params2) ;
   pdf1Clone->fixAddCoefRange(refName.c_str(), true) ;
   pdf2Clone->fixAddCoefRange(refName.c_str(), true) ;
 
@@ -572,24 +625,51 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
   //
   //
 
-  Int_t N;
-  Int_t N2;
-  Int_t binShift1;
+  // In fits where only the parameters of one input p.d.f. float (e.g. the physics model but not the resolution),
+  // the sampling and forward transform of the other input are skipped, and its transform from the previous
+  // filling is used. This is only possible if the cache has a single slice.
+  bool update1 = true;
+  bool update2 = true;
+  if (slicePos.empty()) {
+    // The parameter values are always stored, also if the input was not filled before
+    update1 = parametersChanged(aux.params1, aux.paramValues1) || !aux.filled1;
+    update2 = parametersChanged(aux.params2, aux.paramValues2) || !aux.filled2;
+    aux.filled1 = true;
+    aux.filled2 = true;
+  } else {
+    aux.paramValues1.clear();
+    aux.paramValues2.clear();
+    aux.filled1 = false;
+    aux.filled2 = false;
+  }
+
   Int_t binShift2;
 
   RooRealVar* histX = static_cast<RooRealVar*>(cacheHist.get()->find(_x.arg().GetName())) ;
   if (_bufStrat==Extend) histX->setBinning(*aux.scanBinning) ;
-  std::vector<double> input1 = scanPdf(const_cast<RooRealVar &>(static_cast<RooRealVar const&>(_x.arg())),*aux.pdf1Clone,cacheHist,slicePos,N,N2,binShift1,_shift1) ;
-  std::vector<double> input2 = scanPdf(const_cast<RooRealVar &>(static_cast<RooRealVar const&>(_x.arg())),*aux.pdf2Clone,cacheHist,slicePos,N,N2,binShift2,_shift2) ;
+  std::vector<double> input1;
+  std::vector<double> input2;
+  if (update1) {
+    input1 = scanPdf(const_cast<RooRealVar &>(static_cast<RooRealVar const&>(_x.arg())),*aux.pdf1Clone,cacheHist,slicePos,aux.N,aux.N2,aux.binShift1,_shift1) ;
+  }
+  if (update2) {
+    input2 = scanPdf(const_cast<RooRealVar &>(static_cast<RooRealVar const&>(_x.arg())),*aux.pdf2Clone,cacheHist,slicePos,aux.N,aux.N2,binShift2,_shift2) ;
+  }
   if (_bufStrat==Extend) histX->setBinning(*aux.histBinning) ;
 
+  Int_t N = aux.N;
+  Int_t N2 = aux.N2;
+
 #ifndef ROOFIT_MATH_FFTW3
   // If ROOT was NOT built with the fftw3 interface, we try to include fftw3.h
   // with the interpreter and run the concolution in the interpreter.
   std::vector<double> output(N2);
+  aux.fftOut1.resize(2 * (N2 / 2 + 1));
+  aux.fftOut2.resize(2 * (N2 / 2 + 1));
 
    auto doFFT = declareDoFFT();
-   doFFT(N2, input1.data(), input2.data(), output.data());
+   doFFT(N2, update1 ? input1.data() : nullptr, update2 ? input2.data() : nullptr, aux.fftOut1.data(),
+         aux.fftOut2.data(), output.data());
 #else
   // If ROOT was built with the fftw3 interface, we can use it as a TVirtualFFT
   // plugin. The advantage here is that nothing can go wrong if fftw3.h wahs
@@ -608,12 +688,16 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
   }
 
   // Real->Complex FFT Transform on p.d.f. 1 sampling
-  aux.fftr2c1->SetPoints(input1.data());
-  aux.fftr2c1->Transform();
+  if (update1) {
+    aux.fftr2c1->SetPoints(input1.data());
+    aux.fftr2c1->Transform();
+  }
 
   // Real->Complex FFT Transform on p.d.f 2 sampling
-  aux.fftr2c2->SetPoints(input2.data());
-  aux.fftr2c2->Transform();
+  if (update2) {
+    aux.fftr2c2->SetPoints(input2.data());
+    aux.fftr2c2->Transform();
+  }
 
   // Loop over first half +1 of complex output results, multiply
   // and set as input of reverse transform
@@ -634,7 +718,7 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
   aux.fftc2r->Transform() ;
 #endif
 
-  Int_t totalShift = binShift1 + (N2-N)/2 ;
+  Int_t totalShift = aux.binShift1 + (N2-N)/2 ;
 
   // Store FFT result in cache
 
@@ -936,6 +1020,9 @@ void RooFFTConvPdf::setBufferFraction(double frac)
 void RooFFTConvPdf::setBufferStrategy(BufStrat bs)
 {
   _bufStrat = bs ;
+
+  // Sterilize the cache as the sampled inputs depend on the buffer strategy
+  _cacheMgr.sterilize() ;
 }
 
 
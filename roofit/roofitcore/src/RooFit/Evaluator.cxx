@@ -24,6 +24,19 @@ computations take place in the RooBatchCompute library and can be carried off
 by either the CPU or a CUDA-supporting GPU. The Evaluator class takes care
 of data transfers. An instance of this class is created every time
 RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
+
+If implicit multi-threading is enabled with ROOT::EnableImplicitMT() when the
+Evaluator is created, the CPU evaluation uses the ROOT thread pool in two ways:
+
+  - Independent nodes of the computation graph, like the likelihoods of the
+    different channels of a RooSimultaneous, are evaluated concurrently. Only
+    nodes that compute their output with the RooBatchCompute library are
+    evaluated in parallel tasks, because they read their inputs exclusively from
+    the evaluation context. The other nodes are still evaluated one at a time.
+  - The events of large computations in the RooBatchCompute library are split
+    in chunks that are processed in parallel.
+
+The results are identical to the sequential evaluation.
 **/
 
 #include <RooFit/Evaluator.h>
@@ -31,6 +44,8 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 #include <RooAbsCategory.h>
 #include <RooAbsData.h>
 #include <RooAbsReal.h>
+#include <RooAddModel.h>
+#include <RooAddPdf.h>
 #include <RooRealVar.h>
 #include <RooBatchCompute.h>
 #include <RooMsgService.h>
@@ -41,6 +56,15 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 #include "Detail/Buffers.h"
 #include "RooFitImplHelpers.h"
 
+#include <RConfigure.h>
+
+#ifdef R__USE_IMT
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#include <TROOT.h>
+#endif
+
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <numeric>
@@ -128,6 +152,7 @@ struct NodeInfo {
    bool isDirty = true;
    bool isCategory = false;
    bool hasLogged = false;
+   bool canRunConcurrently = false;
    std::size_t outputSize = 1;
    std::size_t lastSetValCount = std::numeric_limits<std::size_t>::max();
    double scalarBuffer = 0.0;
@@ -176,6 +201,15 @@ Evaluator::Evaluator(const RooAbsReal &absReal, bool useGPU)
 #ifdef ROOFIT_CUDA
    _evalContextCUDA.resize(serverSet.size());
 #endif
+#ifdef R__USE_IMT
+   _useIMT = !_useGPU && ROOT::IsImplicitMTEnabled();
+   if (_useIMT) {
+      _evalContextsIMT.resize(ROOT::GetThreadPoolSize());
+      for (auto &ctx : _evalContextsIMT) {
+         ctx.resize(serverSet.size());
+      }
+   }
+#endif
 
    std::map<RooFit::Detail::DataKey, NodeInfo *> nodeInfos;
 
@@ -341,9 +375,42 @@ void Evaluator::updateOutputSizes()
    }
 #endif
 
+   if (_useIMT) {
+      markConcurrentNodes();
+   }
+
    _needToUpdateOutputSizes = false;
 }
 
+/// Decides which nodes can be evaluated concurrently with other nodes in the
+/// multi-threaded CPU evaluation, and which RooBatchCompute computations are
+/// large enough to be split among threads.
+void Evaluator::markConcurrentNodes()
+{
+   for (auto &info : _nodes) {
+      RooAbsArg *arg = info.absArg;
+
+      // The reducer nodes and the nodes that support CUDA compute their output
+      // from the spans in the evaluation context, without changing the state
+      // of their servers like the generic RooAbsReal::doEval(). The exceptions
+      // are RooAddPdf and RooAddModel, which get the expected events of their
+      // components with the legacy evaluation interface, and fall back to
+      // RooAbsReal::doEval() for per-event coefficients.
+      info.canRunConcurrently = !info.isVariable && !info.fromArrayInput && !info.isCategory &&
+                                (arg->canComputeBatchWithCuda() || arg->isReducerNode()) &&
+                                !dynamic_cast<RooAddPdf const *>(arg) && !dynamic_cast<RooAddModel const *>(arg);
+
+      RooBatchCompute::Config cfg = _evalContextCPU.config(arg);
+      cfg.setMultiThreaded(!info.isScalar());
+      _evalContextCPU.setConfig(arg, cfg);
+   }
+
+   for (auto &ctx : _evalContextsIMT) {
+      ctx._cfgs = _evalContextCPU._cfgs;
+      ctx._offsetMode = _evalContextCPU._offsetMode;
+   }
+}
+
 Evaluator::~Evaluator()
 {
    for (auto &info : _nodes) {
@@ -351,12 +418,10 @@ Evaluator::~Evaluator()
    }
 }
 
-void Evaluator::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
+/// Assigns the output buffer of a node that is evaluated on the CPU, and
+/// registers it in the CPU evaluation context.
+std::span<double> Evaluator::prepareCPUOutput(const RooAbsArg *node, NodeInfo &info)
 {
-   using namespace Detail;
-
-   auto nodeAbsReal = static_cast<RooAbsReal const *>(node);
-
    const std::size_t nOut = info.outputSize;
 
    double *buffer = nullptr;
@@ -388,15 +453,27 @@ void Evaluator::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
       }
       buffer = info.buffer->cpuWritePtr();
    }
-   assignSpan(_evalContextCPU._currentOutput, {buffer, nOut});
    _evalContextCPU.set(node, {buffer, nOut});
-   if (nOut > 1) {
-      _evalContextCPU.enableVectorBuffers(true);
+   return {buffer, nOut};
+}
+
+/// Evaluates a node on the CPU with a given evaluation context.
+void Evaluator::evaluateCPUNode(const RooAbsArg *node, RooFit::EvalContext &ctx, std::span<double> output)
+{
+   assignSpan(ctx._currentOutput, output);
+   if (output.size() > 1) {
+      ctx.enableVectorBuffers(true);
    }
-   nodeAbsReal->doEval(_evalContextCPU);
-   _evalContextCPU.resetVectorBuffers();
-   _evalContextCPU.enableVectorBuffers(false);
+   static_cast<RooAbsReal const *>(node)->doEval(ctx);
+   ctx.resetVectorBuffers();
+   ctx.enableVectorBuffers(false);
+}
+
+void Evaluator::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
+{
+   evaluateCPUNode(node, _evalContextCPU, prepareCPUOutput(node, info));
 #ifdef ROOFIT_CUDA
+   const std::size_t nOut = info.outputSize;
    if (info.copyAfterEvaluation) {
       _evalContextCUDA.set(node, {info.buffer->gpuReadPtr(), nOut});
       if (info.event) {
@@ -445,6 +522,13 @@ std::span<const double> Evaluator::run()
    }
 #endif
 
+   // The first evaluation is always sequential, such that the caches that the
+   // nodes create lazily are filled before any concurrent evaluation.
+   if (_useIMT && _nEvaluations > 1) {
+      runIMT();
+      return _evalContextCPU.at(&_topNode);
+   }
+
    for (auto &nodeInfo : _nodes) {
       if (!nodeInfo.fromArrayInput) {
          if (nodeInfo.isVariable) {
@@ -463,6 +547,98 @@ std::span<const double> Evaluator::run()
    return _evalContextCPU.at(&_topNode);
 }
 
+/// Evaluates the computation graph on the CPU using the implicit
+/// multi-threading pool. The nodes that need to be recomputed are sorted in
+/// levels, such that each node only depends on nodes of the previous levels.
+/// The nodes of a level that can run concurrently are distributed among
+/// parallel tasks, and the other ones are evaluated afterwards on the calling
+/// thread.
+void Evaluator::runIMT()
+{
+#ifdef R__USE_IMT
+   using OutputInfo = std::pair<NodeInfo *, std::span<double>>;
+
+   // Find the nodes to recompute like in the sequential evaluation. Their
+   // output buffers are already assigned here, such that the evaluation
+   // contexts of the tasks only need to be synchronized once.
+   std::vector<std::vector<OutputInfo>> levels;
+   std::vector<std::size_t> nodeLevels(_nodes.size(), 0); // level + 1 for the recomputed nodes
+   for (auto &nodeInfo : _nodes) {
+      if (nodeInfo.fromArrayInput) {
+         continue;
+      }
+      if (nodeInfo.isVariable) {
+         processVariable(nodeInfo);
+         continue;
+      }
+      if (!nodeInfo.isDirty) {
+         continue;
+      }
+      setClientsDirty(nodeInfo);
+      nodeInfo.isDirty = false;
+
+      std::size_t level = 0;
+      for (NodeInfo *serverInfo : nodeInfo.serverInfos) {
+         level = std::max(level, nodeLevels[serverInfo->iNode]);
+      }
+      nodeLevels[nodeInfo.iNode] = level + 1;
+      if (levels.size() <= level) {
+         levels.resize(level + 1);
+      }
+      levels[level].emplace_back(&nodeInfo, prepareCPUOutput(nodeInfo.absArg, nodeInfo));
+   }
+
+   for (auto &ctx : _evalContextsIMT) {
+      ctx._ctx = _evalContextCPU._ctx;
+   }
+
+   ROOT::TThreadExecutor pool;
+   std::vector<OutputInfo> concurrent;
+   std::vector<OutputInfo> sequential;
+   std::vector<bool> isUsedServer(_nodes.size(), false);
+   for (auto const &level : levels) {
+      concurrent.clear();
+      sequential.clear();
+      for (auto const &item : level) {
+         // Some nodes still get the values of servers that are not variables
+         // with RooAbsReal::getVal(), which is why two nodes that share such
+         // a server are not evaluated at the same time.
+         bool canRunConcurrently = item.first->canRunConcurrently;
+         for (NodeInfo *serverInfo : item.first->serverInfos) {
+            canRunConcurrently &= serverInfo->isVariable || !isUsedServer[serverInfo->iNode];
+         }
+         if (canRunConcurrently) {
+            for (NodeInfo *serverInfo : item.first->serverInfos) {
+               isUsedServer[serverInfo->iNode] = true;
+            }
+         }
+         (canRunConcurrently ? concurrent : sequential).emplace_back(item);
+      }
+      for (auto const &item : concurrent) {
+         for (NodeInfo *serverInfo : item.first->serverInfos) {
+            isUsedServer[serverInfo->iNode] = false;
+         }
+      }
+
+      if (concurrent.size() > 1) {
+         const std::size_t nTasks = std::min(concurrent.size(), _evalContextsIMT.size());
+         auto task = [&](std::size_t iTask) {
+            for (std::size_t i = iTask; i < concurrent.size(); i += nTasks) {
+               evaluateCPUNode(concurrent[i].first->absArg, _evalContextsIMT[iTask], concurrent[i].second);
+            }
+         };
+         pool.Foreach(task, ROOT::TSeq<std::size_t>(nTasks));
+      } else {
+         sequential.insert(sequential.end(), concurrent.begin(), concurrent.end());
+      }
+
+      for (auto const &item : sequential) {
+         evaluateCPUNode(item.first->absArg, _evalContextCPU, item.second);
+      }
+   }
+#endif // R__USE_IMT
+}
+
 /// Returns the value of the top node in the computation graph
 std::span<const double> Evaluator::getValHeterogeneous()
 {
@@ -700,6 +876,9 @@ void Evaluator::setOffsetMode(RooFit::EvalContext::OffsetMode mode)
 
    _evalContextCPU._offsetMode = mode;
    _evalContextCUDA._offsetMode = mode;
+   for (auto &ctx : _evalContextsIMT) {
+      ctx._offsetMode = mode;
+   }
 
    for (auto &nodeInfo : _nodes) {
       if (nodeInfo.absArg->isReducerNode()) {
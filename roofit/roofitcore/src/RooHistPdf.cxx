@@ -223,16 +223,23 @@ double RooHistPdf::evaluate() const
 }
 
 void RooHistPdf::rooHistTranslateImpl(RooAbsArg const *klass, RooFit::Detail::CodeSquashContext &ctx, int intOrder,
-                                      RooDataHist const *dataHist, const RooArgSet &obs, bool correctForBinSize)
+                                      RooDataHist const *dataHist, const RooArgSet &obs, bool correctForBinSize,
+                                      bool cdfBoundaries)
 {
+   std::string const &idxName = dataHist->calculateTreeIndexForCodeSquash(klass, ctx, obs);
+
    if (intOrder != 0) {
-      ooccoutE(klass, InputArguments) << "RooHistPdf::weight(" << klass->GetName()
-                                      << ") ERROR: Code Squashing currently only supports non-interpolation cases."
-                                      << std::endl;
+      std::string const &interp =
+         dataHist->interpolateForCodeSquash(klass, ctx, idxName, obs, intOrder, correctForBinSize, cdfBoundaries);
+      std::string resName = ctx.getTmpVarName();
+      ctx.addToCodeBody(klass, "double " + resName + " = " + interp + ";\n");
+      // Like in RooHistPdf::evaluate(), negative interpolated values are clipped for the pdf
+      if (dynamic_cast<RooHistPdf const *>(klass))
+         ctx.addToCodeBody(klass, resName + " = " + resName + " < 0 ? 0 : " + resName + ";\n");
+      ctx.addResult(klass, resName);
       return;
    }
 
-   std::string const &idxName = dataHist->calculateTreeIndexForCodeSquash(klass, ctx, obs);
    std::string const &weightName = dataHist->declWeightArrayForCodeSquash(klass, ctx, correctForBinSize);
    std::string res = weightName;
    if (weightName[0] == '_')
@@ -242,7 +249,7 @@ void RooHistPdf::rooHistTranslateImpl(RooAbsArg const *klass, RooFit::Detail::Co
 
 void RooHistPdf::translate(RooFit::Detail::CodeSquashContext &ctx) const
 {
-   rooHistTranslateImpl(this, ctx, _intOrder, _dataHist, _pdfObsList, !_unitNorm);
+   rooHistTranslateImpl(this, ctx, _intOrder, _dataHist, _pdfObsList, !_unitNorm, _cdfBoundaries);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,10 @@ Additional plotting routines simplify the task of plotting
 the distribution of the minimized likelihood, the fitted parameter values,
 fitted error and pull distribution.
 
+With the Parallelize() option, the samples are generated and fitted in several
+worker processes. The random generator is seeded separately for each sample,
+so the results do not depend on the number of workers.
+
 RooMCStudy provides the option to insert add-in modules
 that modify the generate-and-fit cycle and allow to perform
 extra steps in the cycle. Output of these modules can be stored
@@ -72,8 +76,16 @@ for usage examples.
 #include <RooRealVar.h>
 #include <RooWorkspace.h>
 
+#include <TList.h>
+#ifndef R__WIN32
+#include <ROOT/TProcessExecutor.hxx>
+#include <ROOT/TSeq.hxx>
+#endif
+
 #include <snprintf.h>
+#include <algorithm>
 #include <iostream>
+#include <string>
 
 ClassImp(RooMCStudy);
 
@@ -96,6 +108,11 @@ fitting the PDF to data and accumulating the fit statistics.
 <tr><td> Verbose(bool flag)              <td> Activate informational messages in event generation phase
 <tr><td> Extended(bool flag)             <td> Determine number of events for each sample anew from a Poisson distribution
 <tr><td> Constrain(const RooArgSet& pars)  <td> Apply internal constraints on given parameters in fit and sample constrained parameter values from constraint p.d.f for each toy.
+<tr><td> Parallelize(int nWorkers)         <td> Generate and fit the samples in `nWorkers` forked worker processes. The random
+                                                generator is seeded with a different seed for each sample, derived from the
+                                                current state of RooRandom::randomGenerator(), which makes the results
+                                                independent of the number of workers. Study modules are not supported in
+                                                this mode. Not available on Windows.
 <tr><td> ProtoData(const RooDataSet&, bool randOrder)
          <td> Prototype data for the event generation. If the randOrder flag is set, the order of the dataset will be re-randomized for each generation
               cycle to protect against systematic biases if the number of generated events does not exactly match the number of events in the prototype dataset
@@ -128,6 +145,7 @@ RooMCStudy::RooMCStudy(const RooAbsPdf& model, const RooArgSet& observables,
   pc.defineInt("verboseGen","Verbose",0,0) ;
   pc.defineInt("extendedGen","Extended",0,0) ;
   pc.defineInt("binGenData","Binned",0,0) ;
+  pc.defineInt("nWorkers","Parallelize",0,1) ;
   pc.defineInt("dummy","FitOptArgs",0,0) ;
 
   // Process and check varargs
@@ -152,6 +170,7 @@ RooMCStudy::RooMCStudy(const RooAbsPdf& model, const RooArgSet& observables,
   _extendedGen = pc.getInt("extendedGen") ;
   _binGenData = pc.getInt("binGenData") ;
   _randProto = pc.getInt("randProtoData") ;
+  _nWorkers = pc.getInt("nWorkers") ;
 
   // Process constraints specifications
   const RooArgSet* cParsTmp = pc.getSet("cPars") ;
@@ -330,163 +349,264 @@ bool RooMCStudy::run(bool doGenerate, bool DoFit, Int_t nSamples, Int_t nEvtPerS
     mod->initializeRun(nSamples) ;
   }
 
-  int prescale = nSamples>100 ? int(nSamples/100) : 1 ;
+  if (_nWorkers > 1 && !_modList.empty()) {
+    oocoutW(_fitModel,Generation) << "RooMCStudy::run: WARNING: study modules are not supported with Parallelize(), "
+                                  << "processing the samples sequentially" << std::endl ;
+  }
 
-  while(nSamples--) {
+  if (_nWorkers > 1 && _modList.empty()) {
+    runParallel(doGenerate,DoFit,nSamples,nEvtPerSample,keepGenData,asciiFilePat) ;
+  } else {
+    int prescale = nSamples>100 ? int(nSamples/100) : 1 ;
 
-    if (nSamples%prescale==0) {
-      oocoutP(_fitModel,Generation) << "RooMCStudy::run: " ;
-      if (doGenerate) ooccoutI(_fitModel,Generation) << "Generating " ;
-      if (doGenerate && DoFit) ooccoutI(_fitModel,Generation) << "and " ;
-      if (DoFit) ooccoutI(_fitModel,Generation) << "fitting " ;
-      ooccoutP(_fitModel,Generation) << "sample " << nSamples << std::endl ;
-    }
+    while(nSamples--) {
 
-    std::unique_ptr<RooAbsData> ownedGenSample;
-    _genSample = nullptr;
-    bool existingData = false ;
-    if (doGenerate) {
-      // Generate sample
-      int nEvt(nEvtPerSample) ;
+      if (nSamples%prescale==0) {
+        oocoutP(_fitModel,Generation) << "RooMCStudy::run: " ;
+        if (doGenerate) ooccoutI(_fitModel,Generation) << "Generating " ;
+        if (doGenerate && DoFit) ooccoutI(_fitModel,Generation) << "and " ;
+        if (DoFit) ooccoutI(_fitModel,Generation) << "fitting " ;
+        ooccoutP(_fitModel,Generation) << "sample " << nSamples << std::endl ;
+      }
 
-      // Reset generator parameters to initial values
-      _genParams.assign(_genInitParams) ;
+      runSample(doGenerate,DoFit,nSamples,nEvtPerSample,keepGenData,asciiFilePat) ;
+    }
+  }
 
-      // If constraints are present, sample generator values from constraints
-      if (_constrPdf) {
-        _genParams.assign(*std::unique_ptr<RooDataSet>{_constrGenContext->generate(1)}->get());
-      }
+  for (RooAbsMCStudyModule *mod : _modList) {
+    if (RooDataSet* auxData = mod->finalizeRun()) {
+      _fitParData->merge(auxData) ;
+    }
+  }
 
-      // Save generated parameters if required
-      if (_genParData) {
-   _genParData->add(_genParams) ;
-      }
+  _canAddFitResults = false ;
 
-      // Call module before-generation hook
-      for (RooAbsMCStudyModule *mod : _modList) {
-         mod->processBeforeGen(nSamples) ;
-      }
+  if (_genParData) {
+    for(RooAbsArg * arg : *_genParData->get()) {
+      _genParData->changeObservableName(arg->GetName(),(std::string(arg->GetName()) + "_gen").c_str());
+    }
 
-      if (_binGenData) {
+    _fitParData->merge(_genParData.get());
+  }
 
-   // Calculate the number of (extended) events for this run
-   if (_extendedGen) {
-     _nExpGen = _genModel->expectedEvents(&_dependents) ;
-     nEvt = RooRandom::randomGenerator()->Poisson(nEvtPerSample==0?_nExpGen:nEvtPerSample) ;
-   }
+  if (DoFit) calcPulls() ;
 
-   // Binned generation
-   ownedGenSample = std::unique_ptr<RooDataHist>{_genModel->generateBinned(_dependents,nEvt)};
+  if (_silence) {
+    RooMsgService::instance().setGlobalKillBelow(oldLevel) ;
+  }
 
-      } else {
+  return false ;
+}
 
-   // Calculate the number of (extended) events for this run
-   if (_extendedGen) {
-     _nExpGen = _genModel->expectedEvents(&_dependents) ;
-     nEvt = RooRandom::randomGenerator()->Poisson(nEvtPerSample==0?_nExpGen:nEvtPerSample) ;
-   }
-
-   // Optional randomization of protodata for this run
-   if (_randProto && _genProtoData && _genProtoData->numEntries()!=nEvt) {
-     oocoutI(_fitModel,Generation) << "RooMCStudy: (Re)randomizing event order in prototype dataset (Nevt=" << nEvt << ")" << std::endl ;
-     Int_t* newOrder = _genModel->randomizeProtoOrder(_genProtoData->numEntries(),nEvt) ;
-     _genContext->setProtoDataOrder(newOrder) ;
-     delete[] newOrder ;
-   }
-
-   // Actual generation of events
-   if (nEvt>0) {
-     ownedGenSample = std::unique_ptr<RooAbsData>{_genContext->generate(nEvt)};
-   } else {
-     // Make empty dataset
-     ownedGenSample = std::make_unique<RooDataSet>("emptySample","emptySample",_dependents);
-   }
-      }
 
-   _genSample = ownedGenSample.get();
 
-    //} else if (asciiFilePat && &asciiFilePat) { //warning: the address of 'asciiFilePat' will always evaluate as 'true'
-    } else if (asciiFilePat) {
 
-      // Load sample from ASCII file
-      char asciiFile[1024] ;
-      snprintf(asciiFile,1024,asciiFilePat,nSamples) ;
-      RooArgList depList(_allDependents) ;
-      ownedGenSample = std::unique_ptr<RooDataSet>{RooDataSet::read(asciiFile,depList,"q")};
-      _genSample = ownedGenSample.get();
 
-    } else {
 
-      // Load sample from internal list
-      _genSample = static_cast<RooDataSet*>(_genDataList.At(nSamples)) ;
-      existingData = true ;
-      if (!_genSample) {
-      oocoutW(_fitModel,Generation) << "RooMCStudy::run: WARNING: Sample #" << nSamples << " not loaded, skipping" << std::endl ;
-      continue ;
-      }
+////////////////////////////////////////////////////////////////////////////////
+/// Generate and/or fit the sample with serial number 'nSamples'. Called by run() for each sample.
+
+void RooMCStudy::runSample(bool doGenerate, bool DoFit, Int_t nSamples, Int_t nEvtPerSample, bool keepGenData, const char* asciiFilePat)
+{
+  std::unique_ptr<RooAbsData> ownedGenSample;
+  _genSample = nullptr;
+  bool existingData = false ;
+  if (doGenerate) {
+    // Generate sample
+    int nEvt(nEvtPerSample) ;
+
+    // Reset generator parameters to initial values
+    _genParams.assign(_genInitParams) ;
+
+    // If constraints are present, sample generator values from constraints
+    if (_constrPdf) {
+      _genParams.assign(*std::unique_ptr<RooDataSet>{_constrGenContext->generate(1)}->get());
     }
 
-    // Save number of generated events
-    _ngenVar->setVal(_genSample->sumEntries()) ;
+    // Save generated parameters if required
+    if (_genParData) {
+      _genParData->add(_genParams) ;
+    }
 
-    // Call module between generation and fitting hook
+    // Call module before-generation hook
     for (RooAbsMCStudyModule *mod : _modList) {
-      mod->processBetweenGenAndFit(nSamples) ;
+      mod->processBeforeGen(nSamples) ;
     }
 
-    if (DoFit) fitSample(_genSample) ;
+    if (_binGenData) {
 
-    // Call module between generation and fitting hook
-    for (RooAbsMCStudyModule *mod : _modList) {
-      mod->processAfterFit(nSamples) ;
-    }
+      // Calculate the number of (extended) events for this run
+      if (_extendedGen) {
+        _nExpGen = _genModel->expectedEvents(&_dependents) ;
+        nEvt = RooRandom::randomGenerator()->Poisson(nEvtPerSample==0?_nExpGen:nEvtPerSample) ;
+      }
 
-    // Optionally write to ascii file
-    if (doGenerate && asciiFilePat && *asciiFilePat) {
-      char asciiFile[1024] ;
-      snprintf(asciiFile,1024,asciiFilePat,nSamples) ;
-      if (RooDataSet* unbinnedData = dynamic_cast<RooDataSet*>(_genSample)) {
-   unbinnedData->write(asciiFile) ;
+      // Binned generation
+      ownedGenSample = std::unique_ptr<RooDataHist>{_genModel->generateBinned(_dependents,nEvt)};
+
+    } else {
+
+      // Calculate the number of (extended) events for this run
+      if (_extendedGen) {
+        _nExpGen = _genModel->expectedEvents(&_dependents) ;
+        nEvt = RooRandom::randomGenerator()->Poisson(nEvtPerSample==0?_nExpGen:nEvtPerSample) ;
+      }
+
+      // Optional randomization of protodata for this run
+      if (_randProto && _genProtoData && _genProtoData->numEntries()!=nEvt) {
+        oocoutI(_fitModel,Generation) << "RooMCStudy: (Re)randomizing event order in prototype dataset (Nevt=" << nEvt << ")" << std::endl ;
+        Int_t* newOrder = _genModel->randomizeProtoOrder(_genProtoData->numEntries(),nEvt) ;
+        _genContext->setProtoDataOrder(newOrder) ;
+        delete[] newOrder ;
+      }
+
+      // Actual generation of events
+      if (nEvt>0) {
+        ownedGenSample = std::unique_ptr<RooAbsData>{_genContext->generate(nEvt)};
       } else {
-   coutE(InputArguments) << "RooMCStudy::run(" << GetName() << ") ERROR: ASCII writing of binned datasets is not supported" << std::endl ;
+        // Make empty dataset
+        ownedGenSample = std::make_unique<RooDataSet>("emptySample","emptySample",_dependents);
       }
     }
 
-    // Add to list or delete
-    if (!existingData) {
-      if (keepGenData) {
-   _genDataList.Add(ownedGenSample.release()) ;
-      }
+    _genSample = ownedGenSample.get();
+
+  //} else if (asciiFilePat && &asciiFilePat) { //warning: the address of 'asciiFilePat' will always evaluate as 'true'
+  } else if (asciiFilePat) {
+
+    // Load sample from ASCII file
+    char asciiFile[1024] ;
+    snprintf(asciiFile,1024,asciiFilePat,nSamples) ;
+    RooArgList depList(_allDependents) ;
+    ownedGenSample = std::unique_ptr<RooDataSet>{RooDataSet::read(asciiFile,depList,"q")};
+    _genSample = ownedGenSample.get();
+
+  } else {
+
+    // Load sample from internal list
+    _genSample = static_cast<RooDataSet*>(_genDataList.At(nSamples)) ;
+    existingData = true ;
+    if (!_genSample) {
+      oocoutW(_fitModel,Generation) << "RooMCStudy::run: WARNING: Sample #" << nSamples << " not loaded, skipping" << std::endl ;
+      return ;
     }
   }
 
+  // Save number of generated events
+  _ngenVar->setVal(_genSample->sumEntries()) ;
+
+  // Call module between generation and fitting hook
   for (RooAbsMCStudyModule *mod : _modList) {
-    if (RooDataSet* auxData = mod->finalizeRun()) {
-      _fitParData->merge(auxData) ;
-    }
+    mod->processBetweenGenAndFit(nSamples) ;
   }
 
-  _canAddFitResults = false ;
+  if (DoFit) fitSample(_genSample) ;
 
-  if (_genParData) {
-    for(RooAbsArg * arg : *_genParData->get()) {
-      _genParData->changeObservableName(arg->GetName(),(std::string(arg->GetName()) + "_gen").c_str());
+  // Call module between generation and fitting hook
+  for (RooAbsMCStudyModule *mod : _modList) {
+    mod->processAfterFit(nSamples) ;
+  }
+
+  // Optionally write to ascii file
+  if (doGenerate && asciiFilePat && *asciiFilePat) {
+    char asciiFile[1024] ;
+    snprintf(asciiFile,1024,asciiFilePat,nSamples) ;
+    if (RooDataSet* unbinnedData = dynamic_cast<RooDataSet*>(_genSample)) {
+      unbinnedData->write(asciiFile) ;
+    } else {
+      coutE(InputArguments) << "RooMCStudy::run(" << GetName() << ") ERROR: ASCII writing of binned datasets is not supported" << std::endl ;
     }
+  }
 
-    _fitParData->merge(_genParData.get());
+  // Add to list or delete
+  if (!existingData && keepGenData) {
+    _genDataList.Add(ownedGenSample.release()) ;
   }
+}
 
-  if (DoFit) calcPulls() ;
 
-  if (_silence) {
-    RooMsgService::instance().setGlobalKillBelow(oldLevel) ;
-  }
 
-  return false ;
-}
+////////////////////////////////////////////////////////////////////////////////
+/// Process the 'nSamples' samples in '_nWorkers' forked worker processes. The samples
+/// are split in tasks of consecutive serial numbers. Each worker returns the fit
+/// parameters, generator parameters, fit results and generated samples of a task,
+/// which are merged in the order of the serial numbers, like in a sequential run.
+
+void RooMCStudy::runParallel(bool doGenerate, bool DoFit, Int_t nSamples, Int_t nEvtPerSample, bool keepGenData, const char* asciiFilePat)
+{
+#ifdef R__WIN32
+  oocoutE(_fitModel,Generation) << "RooMCStudy::run: ERROR: Parallelize() is not supported on Windows" << std::endl ;
+  (void)doGenerate; (void)DoFit; (void)nSamples; (void)nEvtPerSample; (void)keepGenData; (void)asciiFilePat;
+#else
+  // More tasks than workers, to balance the load if the fits take different times
+  const int nTasks = std::min(nSamples, 4 * _nWorkers) ;
+  if (nTasks <= 0) return ;
+
+  // Each sample gets its own seed, so the results don't depend on how the samples are split
+  const UInt_t baseSeed = 1 + RooRandom::randomGenerator()->Integer(kMaxUInt - nSamples) ;
+
+  oocoutP(_fitModel,Generation) << "RooMCStudy::run: processing " << nSamples << " samples in " << nTasks
+                                << " tasks with " << _nWorkers << " worker processes" << std::endl ;
+
+  // Executed in the worker processes, on their own copy of this RooMCStudy
+  auto work = [&](int iTask) {
+    _fitParData->reset() ;
+    if (_genParData) _genParData->reset() ;
+    _fitResList.Clear() ;
+    const int nGenData = _genDataList.GetSize() ;
+
+    const int first = nSamples * iTask / nTasks ;
+    for (int iSample = nSamples * (iTask + 1) / nTasks - 1 ; iSample >= first ; --iSample) {
+      RooRandom::randomGenerator()->SetSeed(baseSeed + iSample) ;
+      runSample(doGenerate,DoFit,iSample,nEvtPerSample,keepGenData,asciiFilePat) ;
+    }
 
+    auto output = new TList ;
+    output->SetOwner() ;
+    output->SetName(std::to_string(iTask).c_str()) ;
+    output->Add(_fitParData->Clone("fitParData")) ;
+    if (_genParData) output->Add(_genParData->Clone("genParData")) ;
+    auto fitResults = new TList ;
+    fitResults->SetName("fitResults") ;
+    fitResults->AddAll(&_fitResList) ;
+    output->Add(fitResults) ;
+    auto genData = new TList ;
+    genData->SetName("genData") ;
+    for (int i = nGenData ; i < _genDataList.GetSize() ; ++i) {
+      genData->Add(_genDataList.At(i)) ;
+    }
+    output->Add(genData) ;
+    return output ;
+  } ;
+
+  ROOT::TProcessExecutor pool(_nWorkers) ;
+  std::vector<TList*> results = pool.Map(work, ROOT::TSeqI(nTasks)) ;
+  if (static_cast<int>(results.size()) != nTasks) {
+    oocoutE(_fitModel,Generation) << "RooMCStudy::run: ERROR: only " << results.size() << " of " << nTasks
+                                  << " tasks were processed successfully" << std::endl ;
+  }
 
+  // The results arrive in any order. Sort them like the samples in a sequential run.
+  std::sort(results.begin(), results.end(),
+            [](TList* a, TList* b) { return std::stoi(a->GetName()) > std::stoi(b->GetName()); }) ;
 
+  for (TList* output : results) {
+    _fitParData->append(*static_cast<RooDataSet*>(output->FindObject("fitParData"))) ;
+    if (_genParData) {
+      _genParData->append(*static_cast<RooDataSet*>(output->FindObject("genParData"))) ;
+    }
+    // The fit results and samples are handed over to the lists of this RooMCStudy
+    auto fitResults = static_cast<TList*>(output->FindObject("fitResults")) ;
+    _fitResList.AddAll(fitResults) ;
+    fitResults->Clear("nodelete") ;
+    auto genData = static_cast<TList*>(output->FindObject("genData")) ;
+    _genDataList.AddAll(genData) ;
+    genData->Clear("nodelete") ;
+    output->SetOwner() ;
+    delete output ;
+  }
+#endif
+}
 
 
 
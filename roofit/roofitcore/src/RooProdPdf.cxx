@@ -2369,6 +2369,23 @@ public:
       _prodPdf->doEvalImpl(this, *_cache, ctx);
    }
 
+   void translate(RooFit::Detail::CodeSquashContext &ctx) const override
+   {
+      // Same structure as RooProdPdf::doEvalImpl(): a rearranged conditional
+      // product is a ratio, otherwise we multiply the normalized terms.
+      if (_cache->_isRearranged) {
+         ctx.addResult(this, ctx.buildCall("RooFit::Detail::MathFuncs::ratio", *_cache->_rearrangedNum,
+                                           *_cache->_rearrangedDen));
+         return;
+      }
+      std::string result = "(";
+      for (const RooAbsArg *part : _cache->_partList) {
+         result += ctx.getResult(*part) + "*";
+      }
+      result.back() = ')';
+      ctx.addResult(this, result);
+   }
+
    ExtendMode extendMode() const override { return _prodPdf->extendMode(); }
    double expectedEvents(const RooArgSet * /*nset*/) const override { return _prodPdf->expectedEvents(&_normSet); }
    std::unique_ptr<RooAbsReal> createExpectedEventsFunc(const RooArgSet * /*nset*/) const override
@@ -28,7 +28,8 @@ graph using attachBuffers()). In this case, a get() operation writes the value o
 the requested column into the bound real.
 
 As a faster alternative to loading values one-by-one, one can use the function getBatches(),
-which returns spans pointing directly to the data.
+which returns spans pointing directly to the data. Columns stored in single precision are
+converted into buffers provided by the caller.
 **/
 
 #include "RooVectorDataStore.h"
@@ -147,7 +148,8 @@ RooVectorDataStore::RooVectorDataStore(const RooVectorDataStore& other, const ch
   _extWgtErrLoArray(other._extWgtErrLoArray),
   _extWgtErrHiArray(other._extWgtErrHiArray),
   _extSumW2Array(other._extSumW2Array),
-  _currentWeightIndex(other._currentWeightIndex)
+  _currentWeightIndex(other._currentWeightIndex),
+  _floatStorage(other._floatStorage)
 {
   for (const auto realVec : other._realStoreList) {
     _realStoreList.push_back(new RealVector(*realVec, static_cast<RooAbsReal*>(_varsww.find(realVec->_nativeReal->GetName())))) ;
@@ -205,7 +207,8 @@ RooVectorDataStore::RooVectorDataStore(const RooVectorDataStore& other, const Ro
   _extWgtErrLoArray(other._extWgtErrLoArray),
   _extWgtErrHiArray(other._extWgtErrHiArray),
   _extSumW2Array(other._extSumW2Array),
-  _currentWeightIndex(other._currentWeightIndex)
+  _currentWeightIndex(other._currentWeightIndex),
+  _floatStorage(other._floatStorage)
 {
   for (const auto realVec : other._realStoreList) {
     auto real = static_cast<RooAbsReal*>(vars.find(realVec->bufArg()->GetName()));
@@ -269,6 +272,11 @@ RooVectorDataStore::RooVectorDataStore(RooStringView name, RooStringView title,
   _varsww(vars),
   _wgtVar(weightVar(vars,wgtVarName))
 {
+  RooVectorDataStore* vds = dynamic_cast<RooVectorDataStore*>(&tds) ;
+  if (vds) {
+    _floatStorage = vds->_floatStorage ;
+  }
+
   for (const auto arg : _varsww) {
     arg->attachToVStore(*this) ;
   }
@@ -282,7 +290,6 @@ RooVectorDataStore::RooVectorDataStore(RooStringView name, RooStringView title,
     cloneVar->attachDataStore(tds) ;
   }
 
-  RooVectorDataStore* vds = dynamic_cast<RooVectorDataStore*>(&tds) ;
   if (vds && vds->_cache) {
     _cache = new RooVectorDataStore(*vds->_cache) ;
   }
@@ -1073,9 +1080,11 @@ void RooVectorDataStore::dump()
   for (const auto elm : _realStoreList) {
     cout << "RealVector " << elm << " _nativeReal = " << elm->_nativeReal << " = " << elm->_nativeReal->GetName() << " bufptr = " << elm->_buf  << endl ;
     cout << " values : " ;
-    Int_t imax = elm->_vec.size()>10 ? 10 : elm->_vec.size() ;
+    std::vector<double> buffer ;
+    auto values = elm->getRange(0, 10, buffer) ;
+    Int_t imax = values.size() ;
     for (Int_t i=0 ; i<imax ; i++) {
-      cout << elm->_vec[i] << " " ;
+      cout << values[i] << " " ;
     }
     cout << endl ;
   }
@@ -1085,9 +1094,11 @@ void RooVectorDataStore::dump()
     << " bufptr = " << elm->_buf  << " errbufptr = " << elm->bufE() << endl ;
 
     cout << " values : " ;
-    Int_t imax = elm->_vec.size()>10 ? 10 : elm->_vec.size() ;
+    std::vector<double> buffer ;
+    auto values = elm->getRange(0, 10, buffer) ;
+    Int_t imax = values.size() ;
     for (Int_t i=0 ; i<imax ; i++) {
-      cout << elm->_vec[i] << " " ;
+      cout << values[i] << " " ;
     }
     cout << endl ;
     if (elm->bufE()) {
@@ -1133,12 +1144,23 @@ void RooVectorDataStore::Streamer(TBuffer &R__b)
 /// Return batches of the data columns for the requested events.
 /// \param[in] first First event in the batches.
 /// \param[in] len   Number of events in batches.
+/// \param[in] buffers Buffers for the columns stored in single precision, which are converted into new vectors
+///                    appended to it. It can be null if no column is stored in single precision.
 /// \return Spans with the associated data.
-RooAbsData::RealSpans RooVectorDataStore::getBatches(std::size_t first, std::size_t len) const {
+RooAbsData::RealSpans RooVectorDataStore::getBatches(std::size_t first, std::size_t len, std::vector<std::vector<double>> *buffers) const {
   RooAbsData::RealSpans evalData;
 
-  auto emplace = [this,&evalData,first,len](const RealVector* realVec) {
-    auto span = realVec->getRange(first, first + len);
+  auto emplace = [this,&evalData,first,len,buffers](const RealVector* realVec) {
+    std::span<const double> span;
+    if (realVec->isFloatStorage()) {
+      if (!buffers) {
+        throw std::logic_error(std::string("RooVectorDataStore::getBatches(): the column ") + realVec->_nativeReal->GetName() +
+                               " is stored in single precision, use the overload that takes conversion buffers.");
+      }
+      span = realVec->getRange(first, first + len, buffers->emplace_back());
+    } else {
+      span = realVec->getRange(first, first + len);
+    }
     auto result = evalData.emplace(realVec->_nativeReal, span);
     if (result.second == false || result.first->second.size() != len) {
       const auto size = result.second ? result.first->second.size() : 0;
@@ -1260,6 +1282,9 @@ RooVectorDataStore::RealVector* RooVectorDataStore::addReal(RooAbsReal* real) {
 
   // If nothing found this will make an entry
   _realStoreList.push_back(new RealVector(real)) ;
+  if (_floatStorage && !(_wgtVar && _wgtVar->namePtr() == real->namePtr())) {
+    _realStoreList.back()->setFloatStorage(true) ;
+  }
 
   return _realStoreList.back() ;
 }
@@ -1327,11 +1352,38 @@ RooVectorDataStore::RealFullVector* RooVectorDataStore::addRealFull(RooAbsReal*
 
   // If nothing found this will make an entry
   _realfStoreList.push_back(new RealFullVector(real)) ;
+  if (_floatStorage && !(_wgtVar && _wgtVar->namePtr() == real->namePtr())) {
+    _realfStoreList.back()->setFloatStorage(true) ;
+  }
 
   return _realfStoreList.back() ;
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Store the values of the real-valued observables in single precision, which halves the memory used by large
+/// unbinned datasets. The weights and the errors are always stored in double precision.
+/// The values are converted back to double precision when an event is loaded with get(), and when the columns
+/// are requested with getBatches(), for example when the data is passed to the vectorized likelihood evaluation.
+/// The columns of the optimization cache are not affected.
+/// \param[in] flag Use single-precision (true) or double-precision (false) storage.
+void RooVectorDataStore::setFloatStorage(bool flag)
+{
+  _floatStorage = flag ;
+
+  auto convert = [&](RealVector* realVec) {
+    if (_wgtVar && realVec->_nativeReal->namePtr() == _wgtVar->namePtr()) return ;
+    realVec->setFloatStorage(flag) ;
+  };
+  for (auto realVec : _realStoreList) {
+    convert(realVec) ;
+  }
+  for (auto realVec : _realfStoreList) {
+    convert(realVec) ;
+  }
+}
+
+
 /// Trigger a recomputation of the cached weight sums. Meant for use by RooFit
 /// dataset converter functions such as the NumPy converter functions
 /// implemented as pythonizations.
@@ -1367,12 +1419,18 @@ RooVectorDataStore::ArraysStruct  RooVectorDataStore::getArrays() const {
   ArraysStruct out;
   out.size = size();
 
+  // the columns stored in single precision are converted into buffers owned by the output
+  auto values = [&out](RealVector const* real) {
+    if (!real->isFloatStorage()) return real->getRange(0, real->size()).data();
+    return real->getRange(0, real->size(), out.buffers.emplace_back()).data();
+  };
+
   for(auto const* real : _realStoreList) {
-    out.reals.emplace_back(real->_nativeReal->GetName(), real->_vec.data());
+    out.reals.emplace_back(real->_nativeReal->GetName(), values(real));
   }
   for(auto const* realf : _realfStoreList) {
     std::string name = realf->_nativeReal->GetName();
-    out.reals.emplace_back(name, realf->_vec.data());
+    out.reals.emplace_back(name, values(realf));
     if(realf->bufE()) out.reals.emplace_back(name + "Err", realf->dataE().data());
     if(realf->bufEL()) out.reals.emplace_back(name + "ErrLo", realf->dataEL().data());
     if(realf->bufEH()) out.reals.emplace_back(name + "ErrHi", realf->dataEH().data());
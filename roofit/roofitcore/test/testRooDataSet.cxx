@@ -20,8 +20,10 @@
 #include <TSystem.h>
 #include <TTree.h>
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
+#include <stdexcept>
 
 #include "gtest/gtest.h"
 
@@ -484,3 +486,99 @@ TEST(RooDataSet,RooStringVarStorage) {
    ASSERT_STREQ(dataClone.get(1)->getStringValue("str"),"str2");
 
 }
+
+// Test that the values stored in single precision are read back correctly, while the weights keep double precision.
+TEST(RooDataSet, FloatStorage)
+{
+   RooRealVar x("x", "x", 0, 1);
+   RooRealVar y("y", "y", 0, 1);
+   RooRealVar w("w", "w", 0, 10);
+   RooDataSet data("data", "data", {x, y, w}, RooFit::WeightVar(w));
+
+   TRandom3 rng(1337);
+   std::vector<double> xValues;
+   std::vector<double> weights;
+   for (int i = 0; i < 100; ++i) {
+      x.setVal(rng.Rndm());
+      y.setVal(rng.Rndm());
+      xValues.push_back(x.getVal());
+      weights.push_back(rng.Uniform(0, 10));
+      data.add({x, y}, weights.back());
+   }
+
+   data.setFloatStorage();
+   auto store = static_cast<RooVectorDataStore const *>(data.store());
+   ASSERT_TRUE(store->isFloatStorage());
+
+   // new entries are also stored in single precision
+   x.setVal(0.1);
+   xValues.push_back(x.getVal());
+   weights.push_back(1.5);
+   data.add({x, y}, weights.back());
+
+   ASSERT_EQ(data.numEntries(), static_cast<int>(xValues.size()));
+   std::vector<std::vector<double>> buffers;
+   auto spans = data.getBatches(0, data.numEntries(), buffers);
+   std::span<const double> xSpan = spans.at(&x);
+   for (int i = 0; i < data.numEntries(); ++i) {
+      const RooArgSet *row = data.get(i);
+      EXPECT_EQ(row->getRealValue("x"), static_cast<float>(xValues[i]));
+      EXPECT_EQ(xSpan[i], static_cast<float>(xValues[i]));
+      EXPECT_EQ(data.weight(), weights[i]);
+   }
+
+   // the storage type survives the reduction of the dataset
+   std::unique_ptr<RooAbsData> reduced{data.reduce(RooFit::SelectVars(x))};
+   EXPECT_TRUE(static_cast<RooVectorDataStore const *>(reduced->store())->isFloatStorage());
+   EXPECT_EQ(reduced->get(3)->getRealValue("x"), static_cast<float>(xValues[3]));
+
+   // going back to double precision keeps the rounded values
+   data.setFloatStorage(false);
+   EXPECT_FALSE(store->isFloatStorage());
+   EXPECT_EQ(data.get(3)->getRealValue("x"), static_cast<float>(xValues[3]));
+}
+
+// Test that the columns stored in single precision are converted into the buffers of the caller, and that no
+// converted copy is kept in the dataset.
+TEST(RooDataSet, FloatStorageBatchesNotRetained)
+{
+   RooRealVar x("x", "x", 0, 1);
+   RooRealVar y("y", "y", 0, 1);
+   RooDataSet data("data", "data", {x, y});
+   for (int i = 0; i < 1000; ++i) {
+      x.setVal(i / 1000.);
+      y.setVal(1. - i / 1000.);
+      data.add({x, y});
+   }
+   data.setFloatStorage();
+
+   // without conversion buffers, the single-precision columns can't be handed out
+   EXPECT_THROW(data.getBatches(0, data.numEntries()), std::logic_error);
+
+   for (int iCall = 0; iCall < 3; ++iCall) {
+      std::vector<std::vector<double>> buffers;
+      auto spans = data.getBatches(0, data.numEntries(), buffers);
+      ASSERT_EQ(buffers.size(), 2u);
+
+      // every span points into one of the buffers of the caller
+      for (auto const *var : {&x, &y}) {
+         std::span<const double> span = spans.at(var);
+         ASSERT_EQ(span.size(), static_cast<std::size_t>(data.numEntries()));
+         const bool inBuffers = std::any_of(buffers.begin(), buffers.end(),
+                                            [&](std::vector<double> const &buffer) { return buffer.data() == span.data(); });
+         EXPECT_TRUE(inBuffers) << var->GetName();
+         EXPECT_EQ(span[10], static_cast<float>(var == &x ? 10 / 1000. : 1. - 10 / 1000.));
+      }
+   }
+
+   // the exported arrays own their converted columns as well
+   auto arrays = static_cast<RooVectorDataStore const *>(data.store())->getArrays();
+   EXPECT_EQ(arrays.buffers.size(), 2u);
+   ASSERT_EQ(arrays.reals.size(), 2u);
+   for (auto const &info : arrays.reals) {
+      const bool inBuffers =
+         std::any_of(arrays.buffers.begin(), arrays.buffers.end(),
+                     [&](std::vector<double> const &buffer) { return buffer.data() == info.data; });
+      EXPECT_TRUE(inBuffers) << info.name;
+   }
+}
@@ -0,0 +1,156 @@
+// Tests for the RooFFTConvPdf
+
+#include <RooFFTConvPdf.h>
+#include <RooGaussian.h>
+#include <RooGenericPdf.h>
+#include <RooRealVar.h>
+
+#include <TMath.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+std::vector<double> sampleValues(RooAbsPdf &pdf, RooRealVar &x)
+{
+   std::vector<double> out;
+   for (double val : {-3.0, -1.2, -0.3, 0.0, 0.4, 1.5, 2.7}) {
+      x.setVal(val);
+      out.push_back(pdf.getVal(x));
+   }
+   return out;
+}
+
+} // namespace
+
+/// The convolution with an input p.d.f. that has no parameters has to sample
+/// and transform that input at the first filling of the cache.
+TEST(RooFFTConvPdf, ResolutionWithoutParameters)
+{
+   RooRealVar x{"x", "x", -10, 10};
+   x.setBins(10000, "cache");
+
+   RooRealVar mean{"mean", "mean", 0.5, -5, 5};
+   RooRealVar sigma{"sigma", "sigma", 1.0, 0.1, 5};
+   RooGaussian gauss{"gauss", "gauss", x, mean, sigma};
+
+   // Gaussian resolution with width 0.5 that depends only on the observable
+   RooGenericPdf resolution{"resolution", "std::exp(-0.5 * x * x / 0.25)", {x}};
+
+   RooFFTConvPdf conv{"conv", "conv", x, gauss, resolution};
+
+   // The convolution of two Gaussians is a Gaussian with the widths added in quadrature
+   auto checkAnalytical = [&]() {
+      const double sigmaConv = std::sqrt(sigma.getVal() * sigma.getVal() + 0.25);
+      for (double val : {-2.0, -0.5, 0.5, 1.0, 2.5}) {
+         x.setVal(val);
+         const double arg = (val - mean.getVal()) / sigmaConv;
+         const double ref = std::exp(-0.5 * arg * arg) / (std::sqrt(TMath::TwoPi()) * sigmaConv);
+         EXPECT_NEAR(conv.getVal(x), ref, 1e-3 * ref) << "x = " << val;
+      }
+   };
+
+   checkAnalytical();
+
+   // Only the first input changes, the transform of the resolution is reused
+   mean.setVal(-0.7);
+   sigma.setVal(1.3);
+   checkAnalytical();
+}
+
+/// The convolution of two input p.d.f.s without parameters has to be filled as well.
+TEST(RooFFTConvPdf, InputsWithoutParameters)
+{
+   RooRealVar x{"x", "x", -10, 10};
+   x.setBins(10000, "cache");
+
+   RooGenericPdf pdf1{"pdf1", "std::exp(-0.5 * (x - 1.) * (x - 1.))", {x}};
+   RooGenericPdf pdf2{"pdf2", "std::exp(-0.5 * x * x / 0.25)", {x}};
+
+   RooFFTConvPdf conv{"conv", "conv", x, pdf1, pdf2};
+
+   const double sigmaConv = std::sqrt(1.25);
+   for (double val : {-1.0, 0.5, 1.0, 2.5}) {
+      x.setVal(val);
+      const double arg = (val - 1.0) / sigmaConv;
+      const double ref = std::exp(-0.5 * arg * arg) / (std::sqrt(TMath::TwoPi()) * sigmaConv);
+      EXPECT_NEAR(conv.getVal(x), ref, 1e-3 * ref) << "x = " << val;
+   }
+}
+
+/// If only the parameters of one input change, the refilled cache has to give
+/// the same values as a freshly created convolution.
+TEST(RooFFTConvPdf, PartialRefill)
+{
+   RooRealVar x{"x", "x", -10, 10};
+   x.setBins(1000, "cache");
+
+   RooRealVar mean1{"mean1", "mean1", 0.0, -5, 5};
+   RooRealVar sigma1{"sigma1", "sigma1", 1.0, 0.1, 5};
+   RooGaussian gauss1{"gauss1", "gauss1", x, mean1, sigma1};
+
+   RooRealVar mean2{"mean2", "mean2", 0.2, -5, 5};
+   RooRealVar sigma2{"sigma2", "sigma2", 0.5, 0.1, 5};
+   RooGaussian gauss2{"gauss2", "gauss2", x, mean2, sigma2};
+
+   RooFFTConvPdf conv{"conv", "conv", x, gauss1, gauss2};
+
+   auto compareWithFresh = [&]() {
+      RooFFTConvPdf convFresh{"convFresh", "convFresh", x, gauss1, gauss2};
+      std::vector<double> values = sampleValues(conv, x);
+      std::vector<double> valuesFresh = sampleValues(convFresh, x);
+      for (std::size_t i = 0; i < values.size(); ++i) {
+         EXPECT_DOUBLE_EQ(values[i], valuesFresh[i]) << "point " << i;
+      }
+   };
+
+   compareWithFresh();
+
+   // Only the first input changes
+   mean1.setVal(0.8);
+   compareWithFresh();
+   sigma1.setVal(1.7);
+   compareWithFresh();
+
+   // Only the second input changes
+   sigma2.setVal(0.9);
+   compareWithFresh();
+
+   // Both inputs change
+   mean1.setVal(-1.1);
+   mean2.setVal(-0.3);
+   compareWithFresh();
+}
+
+/// After a change of the buffer strategy, a refill triggered by the parameters
+/// of one input must not reuse the other input sampled with the old strategy.
+TEST(RooFFTConvPdf, ChangeBufferStrategy)
+{
+   RooRealVar x{"x", "x", -5, 5};
+   x.setBins(1000, "cache");
+
+   RooRealVar mean1{"mean1", "mean1", 1.5, -5, 5};
+   RooRealVar sigma1{"sigma1", "sigma1", 1.5, 0.1, 5};
+   RooGaussian gauss1{"gauss1", "gauss1", x, mean1, sigma1};
+
+   RooRealVar mean2{"mean2", "mean2", 0.5, -5, 5};
+   RooRealVar sigma2{"sigma2", "sigma2", 1.0, 0.1, 5};
+   RooGaussian gauss2{"gauss2", "gauss2", x, mean2, sigma2};
+
+   RooFFTConvPdf conv{"conv", "conv", x, gauss1, gauss2};
+   sampleValues(conv, x);
+
+   conv.setBufferStrategy(RooFFTConvPdf::Mirror);
+   mean1.setVal(0.8);
+
+   RooFFTConvPdf convFresh{"convFresh", "convFresh", x, gauss1, gauss2};
+   convFresh.setBufferStrategy(RooFFTConvPdf::Mirror);
+   std::vector<double> values = sampleValues(conv, x);
+   std::vector<double> valuesFresh = sampleValues(convFresh, x);
+   for (std::size_t i = 0; i < values.size(); ++i) {
+      EXPECT_DOUBLE_EQ(values[i], valuesFresh[i]) << "point " << i;
+   }
+}
@@ -34,6 +34,7 @@
 #include <RooRealVar.h>
 #include <RooSimultaneous.h>
 #include <RooWorkspace.h>
+#include <RooStats/HistFactory/FlexibleInterpVar.h>
 
 #include <ROOT/StringUtils.hxx>
 #include <TROOT.h>
@@ -167,6 +168,36 @@ TEST(RooFuncWrapper, Exponential)
    }
 }
 
+/// Check that several interpolation codes in the same FlexibleInterpVar are
+/// supported by the code generation.
+TEST(RooFuncWrapper, FlexibleInterpVarMixedCodes)
+{
+   RooRealVar alpha1{"alpha1", "alpha1", 0.3, -5, 5};
+   RooRealVar alpha2{"alpha2", "alpha2", -0.7, -5, 5};
+   RooRealVar alpha3{"alpha3", "alpha3", 1.4, -5, 5};
+
+   RooStats::HistFactory::FlexibleInterpVar interpVar{
+      "interpVar", "interpVar", {alpha1, alpha2, alpha3}, 1.0, {0.9, 0.8, 0.95}, {1.1, 1.3, 1.02}, {0, 1, 4}};
+
+   RooFit::Experimental::RooFuncWrapper interpFunc("interpFunc", "interpFunc", interpVar, nullptr, nullptr, false);
+   interpFunc.createGradient();
+
+   RooArgSet params{alpha1, alpha2, alpha3};
+   RooArgSet normSet;
+
+   EXPECT_NEAR(interpVar.getVal(), interpFunc.getVal(), 1e-8);
+
+   // Get AD based derivative
+   std::vector<double> dInterp(interpFunc.getNumParams(), 0);
+   interpFunc.gradient(dInterp.data());
+
+   // Check if derivatives are equal
+   for (std::size_t i = 0; i < params.size(); ++i) {
+      EXPECT_NEAR(getNumDerivative(interpVar, static_cast<RooRealVar &>(*params[i]), normSet), dInterp[i], 1e-6)
+         << params[i]->GetName();
+   }
+}
+
 using CreateNLLFunc =
    std::function<std::unique_ptr<RooAbsReal>(RooAbsPdf &, RooAbsData &, RooWorkspace &, RooFit::EvalBackend)>;
 using WorkspaceSetupFunc = std::function<void(RooWorkspace &)>;
@@ -450,7 +481,7 @@ FactoryTestParams param6{"GaussianExtended",
                          1e-4,
                          /*randomizeParameters=*/false};
 namespace {
-void getDataHistModel(RooWorkspace &ws)
+void getDataHistModel(RooWorkspace &ws, int intOrder)
 {
    RooRealVar x("x", "x", 6, 0, 20);
    RooPolynomial p("p", "p", x, RooArgList(0.01, -0.01, 0.0004));
@@ -463,7 +494,7 @@ void getDataHistModel(RooWorkspace &ws)
    std::unique_ptr<RooDataHist> hist1{p.generateBinned(x, 500)};
 
    // Represent data in dh as pdf in x
-   RooHistPdf histpdf("histpdf", "histpdf", x, *hist1, 0);
+   RooHistPdf histpdf("histpdf", "histpdf", x, *hist1, intOrder);
 
    RooRealVar mean("mean", "mean of gaussian", 6, 5, 10);
    RooRealVar sigma("sigma", "width of gaussian", 1.0, .01, 3.0);
@@ -478,13 +509,21 @@ void getDataHistModel(RooWorkspace &ws)
 } // namespace
 
 /// Test based on rf706 tutorial
-FactoryTestParams param7{"HistPdf", getDataHistModel,
+FactoryTestParams param7{"HistPdf", [](RooWorkspace &ws) { getDataHistModel(ws, 0); },
                          [](RooAbsPdf &pdf, RooAbsData &data, RooWorkspace &, RooFit::EvalBackend backend) {
                             return std::unique_ptr<RooAbsReal>{pdf.createNLL(data, backend)};
                          },
                          1e-4,
                          /*randomizeParameters=*/true};
 
+// Same as the previous test, but with quadratic interpolation between the bins.
+FactoryTestParams param7p1{"HistPdfInterpolated", [](RooWorkspace &ws) { getDataHistModel(ws, 2); },
+                           [](RooAbsPdf &pdf, RooAbsData &data, RooWorkspace &, RooFit::EvalBackend backend) {
+                              return std::unique_ptr<RooAbsReal>{pdf.createNLL(data, backend)};
+                           },
+                           1e-4,
+                           /*randomizeParameters=*/true};
+
 FactoryTestParams param8{"Lognormal",
                          [](RooWorkspace &ws) {
                             ws.factory("Lognormal::model(x[1.0, 1.1, 10], mu[2.0, 1.1, 10], k[2.0, 1.1, 5.0])");
@@ -621,6 +660,23 @@ FactoryTestParams param15{"RecursiveFraction",
                           5e-3,
                           /*randomizeParameters=*/true};
 
+// Test for a product with a conditional pdf, where the mean of the x
+// distribution depends on the other observable y.
+FactoryTestParams param16{"ConditionalProdPdf",
+                          [](RooWorkspace &ws) {
+                             ws.factory("Gaussian::gx(x[0, -10, 10], y[0, -10, 10], sigmax[2.0, 0.1, 10])");
+                             ws.factory("Gaussian::gy(y, muy[0.5, -5, 5], sigmay[3.0, 0.1, 10])");
+                             ws.factory("PROD::model(gx|y, gy)");
+
+                             ws.defineSet("observables", "x,y");
+                          },
+                          [](RooAbsPdf &pdf, RooAbsData &data, RooWorkspace &, RooFit::EvalBackend backend) {
+                             using namespace RooFit;
+                             return std::unique_ptr<RooAbsReal>{pdf.createNLL(data, backend)};
+                          },
+                          5e-3,
+                          /*randomizeParameters=*/true};
+
 FactoryTestParams makeTestParams(const char *name, std::string const& expr, bool randomizeParameters)
 {
    return FactoryTestParams{name,
@@ -640,7 +696,8 @@ auto testValues = testing::Values(
 #if !defined(_MSC_VER) || defined(R__ENABLE_BROKEN_WIN_TESTS)
    param3,
 #endif
-   param4, param5, param6, param7, param8, param8p1, param9, param10, param11, param12, param13, param15,
+   param4, param5, param6, param7, param7p1, param8, param8p1, param9, param10, param11, param12, param13, param15,
+   param16,
    // TODO: the RooCBShape test is disabled for now, because the gradient doesn't work with Clad v1.4.
    // makeTestParams("RooCBShape",
    //               "CBShape::model(x[0., -200., 200.], x0[100., -200., 200.], sigma[2., 1.E-6, 100.], alpha[1., 1.E-6, 100.], n[1., 1.E-6, 100.])",
@@ -0,0 +1,46 @@
+// Tests for the RooMCStudy
+
+#include <RooDataSet.h>
+#include <RooGaussian.h>
+#include <RooGlobalFunc.h>
+#include <RooMCStudy.h>
+#include <RooRandom.h>
+#include <RooRealVar.h>
+
+#include <gtest/gtest.h>
+
+// Check that the samples of a RooMCStudy processed in several worker
+// processes give the same results independent of the number of workers.
+TEST(RooMCStudy, Parallelize)
+{
+   using namespace RooFit;
+
+   RooRealVar x{"x", "x", 0, -10, 10};
+   RooRealVar mean{"mean", "mean", 1, -10, 10};
+   RooRealVar sigma{"sigma", "sigma", 2, 0.1, 10};
+   RooGaussian gauss{"gauss", "gauss", x, mean, sigma};
+
+   constexpr int nSamples = 20;
+
+   auto runStudy = [&](int nWorkers) {
+      RooRandom::randomGenerator()->SetSeed(1337);
+      RooMCStudy mcstudy{gauss, x, Silence(), Parallelize(nWorkers), FitOptions(PrintLevel(-1))};
+      mcstudy.generateAndFit(nSamples, 500);
+      return std::make_unique<RooDataSet>(mcstudy.fitParDataSet());
+   };
+
+   std::unique_ptr<RooDataSet> fitPars2 = runStudy(2);
+   std::unique_ptr<RooDataSet> fitPars3 = runStudy(3);
+
+   ASSERT_EQ(fitPars2->numEntries(), nSamples);
+   ASSERT_EQ(fitPars3->numEntries(), nSamples);
+
+   for (int i = 0; i < nSamples; ++i) {
+      const RooArgSet &row2 = *fitPars2->get(i);
+      const double mean2 = row2.getRealValue("mean");
+      const double nll2 = row2.getRealValue("NLL");
+      const RooArgSet &row3 = *fitPars3->get(i);
+      EXPECT_DOUBLE_EQ(row3.getRealValue("mean"), mean2) << "sample " << i;
+      EXPECT_DOUBLE_EQ(row3.getRealValue("NLL"), nll2) << "sample " << i;
+   }
+}
@@ -16,9 +16,13 @@
 #include <RooThresholdCategory.h>
 #include <RooWorkspace.h>
 
+#include <RConfigure.h>
+#include <TROOT.h>
+
 #include "gtest_wrapper.h"
 
 #include <memory>
+#include <vector>
 
 /// Forum issue
 /// https://root-forum.cern.ch/t/roofit-failed-to-create-nll-for-simultaneous-pdfs-with-multiple-range-names/49363.
@@ -371,3 +375,72 @@ TEST(RooSimultaneous, NestedSimPdfGenContext)
    EXPECT_EQ(catIndex(data2->get(1), "c1"), catIndex(proto.get(1), "c1"));
    EXPECT_EQ(catIndex(data2->get(1), "c2"), catIndex(proto.get(1), "c2"));
 }
+
+#ifdef R__USE_IMT
+/// With implicit multi-threading, the CPU evaluation backend evaluates the
+/// channels of a RooSimultaneous concurrently and splits the large
+/// computations among threads. The likelihood values have to be identical to
+/// the ones of the sequential evaluation.
+TEST(RooSimultaneous, MultiThreadedEvaluation)
+{
+   using namespace RooFit;
+
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRandom::randomGenerator()->SetSeed(1);
+
+   constexpr int nChannels = 6;
+
+   RooWorkspace ws;
+   ws.factory("x[0, 10]");
+   ws.factory("c[-0.2, -1, 0]");
+   RooCategory cat{"cat", ""};
+
+   RooSimultaneous simPdf{"simPdf", "", cat};
+   std::map<std::string, std::unique_ptr<RooDataSet>> datasets;
+   for (int i = 0; i < nChannels; ++i) {
+      const std::string suffix = std::to_string(i);
+      cat.defineType("ch" + suffix, i);
+      ws.factory("Gaussian::sig" + suffix + "(x, mu" + suffix + "[" + std::to_string(2 + i) + ", 0, 10], sigma" + suffix +
+                 "[1, 0.1, 5])");
+      ws.factory("Exponential::bkg" + suffix + "(x, c)");
+      RooAbsPdf &pdf = *static_cast<RooAbsPdf *>(
+         ws.factory("SUM::model" + suffix + "(f" + suffix + "[0.5, 0, 1] * sig" + suffix + ", bkg" + suffix + ")"));
+      simPdf.addPdf(pdf, ("ch" + suffix).c_str());
+      // The first channel has enough events to split the computations among threads
+      datasets["ch" + suffix] = std::unique_ptr<RooDataSet>{pdf.generate(*ws.var("x"), i == 0 ? 40000 : 1000)};
+   }
+   RooDataSet data{"data", "", *ws.var("x"), Index(cat), Import(datasets)};
+
+   RooArgSet params;
+   simPdf.getParameters(data.get(), params);
+   RooArgSet initialParams;
+   params.snapshot(initialParams);
+
+   auto evaluate = [&]() {
+      params.assign(initialParams);
+      std::unique_ptr<RooAbsReal> nll{simPdf.createNLL(data, EvalBackend::Cpu())};
+      std::vector<double> values;
+      values.push_back(nll->getVal());
+      for (int i = 0; i < nChannels; ++i) {
+         // Change the parameters of one channel, and then a parameter shared by all channels
+         ws.var("mu" + std::to_string(i))->setVal(2.5 + i);
+         values.push_back(nll->getVal());
+      }
+      ws.var("c")->setVal(-0.3);
+      values.push_back(nll->getVal());
+      return values;
+   };
+
+   std::vector<double> sequential = evaluate();
+
+   ROOT::EnableImplicitMT(4);
+   std::vector<double> multiThreaded = evaluate();
+   ROOT::DisableImplicitMT();
+
+   ASSERT_EQ(multiThreaded.size(), sequential.size());
+   for (std::size_t i = 0; i < sequential.size(); ++i) {
+      EXPECT_EQ(multiThreaded[i], sequential[i]) << "evaluation " << i;
+   }
+}
+#endif
@@ -22,6 +22,7 @@ class TGraphErrors;
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace RooStats {
 
@@ -97,6 +98,8 @@ public:
 
    bool RunOnePoint( double thisX, bool adaptive = false, double clTarget = -1 ) const;
 
+   bool RefineScan( int nPoints, int nIterations = 1 ) const;
+
    //bool RunAutoScan( double xMin, double xMax, double target, double epsilon=nullptr.005, unsigned int numAlgorithm=nullptr );
 
    bool RunLimit(double &limit, double &limitErr, double absTol = 0, double relTol = 0, const double *hint=nullptr) const;
@@ -146,6 +149,10 @@ public:
    /// set numerical error in test statistic evaluation (default is zero)
    void SetNumErr(double err) { fNumErr = err; }
 
+   /// set the number of processes used to run the points of a fixed scan and of its refinement in parallel.
+   /// The automatic scan (RunLimit) is always run sequentially.
+   void SetNWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+
    /// set flag to close proof for every new run
    static void SetCloseProof(bool flag);
 
@@ -163,6 +170,18 @@ protected:
    /// run the hybrid at a single point
    HypoTestResult * Eval( HypoTestCalculatorGeneric &hc, bool adaptive , double clsTarget) const;
 
+   /// return the point clamped to the range of the scanned variable
+   double ClampToRange( double rVal) const;
+
+   /// set the null snapshot and run the hypothesis test at the given point
+   HypoTestResult * EvalPoint( double rVal, bool adaptive, double clTarget) const;
+
+   /// add the result for a point to the HypoTestInverterResult
+   bool AddPointResult( double rVal, std::unique_ptr<HypoTestResult> result) const;
+
+   /// run the given points, in parallel if requested
+   void RunPoints( const std::vector<double> &xValues) const;
+
    /// helper functions
    static RooRealVar * GetVariableToScan(const HypoTestCalculatorGeneric &hc);
    static void CheckInputModels(const HypoTestCalculatorGeneric &hc, const RooRealVar & scanVar);
@@ -199,6 +218,7 @@ private:
    double fXmin;
    double fXmax;
    double fNumErr;
+   unsigned int fNWorkers = 1; ///<! number of processes used for the fixed scans
 
 protected:
 
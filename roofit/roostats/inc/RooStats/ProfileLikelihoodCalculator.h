@@ -15,6 +15,8 @@
 
 #include "RooStats/LikelihoodInterval.h"
 
+class TH1;
+
 namespace RooStats {
 
    class LikelihoodInterval;
@@ -53,6 +55,10 @@ namespace RooStats {
       /// floating (global maximum likelihood value).
       HypoTestResult* GetHypoTest() const override;
 
+      /// Scan the profile likelihood ratio \f$ -2 \ln \lambda \f$ on a grid of nPoints values in the range of
+      /// each parameter of interest, in nWorkers processes. Only one or two parameters of interest are supported.
+      TH1* GetProfileLikelihoodScan(int nPoints, unsigned int nWorkers = 1) const;
+
 
 
    protected:
@@ -80,6 +80,7 @@ class ToyMCSampler: public TestStatSampler {
       SamplingDistribution* GetSamplingDistribution(RooArgSet& paramPoint) override;
       virtual RooDataSet* GetSamplingDistributions(RooArgSet& paramPoint);
       virtual RooDataSet* GetSamplingDistributionsSingleWorker(RooArgSet& paramPoint);
+      virtual RooDataSet* GetSamplingDistributionsMultiProcess(RooArgSet& paramPoint);
 
       virtual SamplingDistribution* AppendSamplingDistribution(
          RooArgSet& allParameters,
@@ -229,6 +230,14 @@ class ToyMCSampler: public TestStatSampler {
       /// calling with argument or nullptr deactivates proof
       void SetProofConfig(ProofConfig *pc = nullptr) { fProofConfig = pc; }
 
+      /// Generate and evaluate the toys in `nWorkers` forked processes, in tasks of `nToysPerTask` toys.
+      /// Each task gets its own random seed, so the results only depend on the task size and not on
+      /// the number of workers. Adaptive sampling is not supported in this mode. Not available on Windows.
+      void SetNWorkers(unsigned int nWorkers, Int_t nToysPerTask = 100) {
+         fNWorkers = nWorkers;
+         fNToysPerTask = nToysPerTask > 0 ? nToysPerTask : 1;
+      }
+
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
    protected:
@@ -275,6 +284,8 @@ class ToyMCSampler: public TestStatSampler {
       const RooDataSet *fProtoData = nullptr; ///< in dev
 
       ProofConfig *fProofConfig = nullptr; ///<!
+      unsigned int fNWorkers = 1;         ///<! number of processes for the toys
+      Int_t fNToysPerTask = 100;          ///<! number of toys per task in multi-process runs
 
       mutable NuisanceParametersSampler *fNuisanceParametersSampler = nullptr; ///<!
 
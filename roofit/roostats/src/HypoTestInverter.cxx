@@ -26,6 +26,19 @@ The  HypoTestInverter implements various options for performing the scan.
 - HypoTestInverter::SetAutoScan will perform an automatic scan to find
 optimally the curve. It will stop when the desired precision is obtained.
 - HypoTestInverter::RunOnePoint computes the confidence level at a given point.
+- HypoTestInverter::RefineScan adds points to a previous scan between the points enclosing the limits.
+
+The points of a fixed scan (and of its refinement) can be evaluated in parallel, in several processes each
+working on its own copy of the models and of the data, after calling HypoTestInverter::SetNWorkers:
+~~~{.cpp}
+HypoTestInverter inverter(calc);
+inverter.SetNWorkers(8);
+inverter.RunFixedScan(16, 0, 10);
+inverter.RefineScan(8, 2);
+auto result = inverter.GetInterval();
+~~~
+Every point is generated with its own random seed, derived from the RooRandom generator, so that the results
+don't depend on the number of workers.
 
 ### CLs presciption
 The class can scan the CLs+b values or alternatively CLs. For the latter,
@@ -61,12 +74,21 @@ call HypoTestInverter::UseCLs().
 #include "TLine.h"
 #include "TCanvas.h"
 #include "TGraphErrors.h"
+#include "TList.h"
 
 #include "RooStats/ProofConfig.h"
 
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <memory>
+#include <string>
+#include <vector>
 
 ClassImp(RooStats::HypoTestInverter);
 
@@ -408,6 +430,7 @@ HypoTestInverter & HypoTestInverter::operator= (const HypoTestInverter & rhs) {
    fXmin = rhs.fXmin;
    fXmax = rhs.fXmax;
    fNumErr = rhs.fNumErr;
+   fNWorkers = rhs.fNWorkers;
 
    return *this;
 }
@@ -648,28 +671,161 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
      return false;
    }
 
-   double thisX = xMin;
-   for (int i=0; i<nBins; i++) {
-
-      if (i > 0) { // avoids case of nBins = 1
+   std::vector<double> xValues(nBins, xMin);
+   for (int i=1; i<nBins; i++) { // avoids case of nBins = 1
       if (scanLog) {
-            thisX = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
+         xValues[i] = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
       } else {
-            thisX = xMin + i * (xMax - xMin) / (nBins - 1); // linear scan in x
-      }
+         xValues[i] = xMin + i * (xMax - xMin) / (nBins - 1); // linear scan in x
       }
+   }
+
+   RunPoints(xValues);
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Refine a previous scan around the points where the confidence level curve crosses the target
+/// $ 1 - CL $, i.e. around the upper limit (and the lower limit in case of two-sided tests).
+/// Each iteration runs nPoints equidistant points between the two scanned points enclosing every crossing,
+/// so the interval bracketing the limit shrinks by a factor nPoints+1 per iteration.
+/// When using several workers (see SetNWorkers), a number of points equal to (a multiple of) the number of
+/// workers makes the best use of them.
+/// \param[in] nPoints Number of points to add between the points enclosing each crossing.
+/// \param[in] nIterations Number of refinement iterations.
+
+bool HypoTestInverter::RefineScan(int nPoints, int nIterations) const
+{
+   if (!fResults || fResults->ArraySize() < 2) {
+      oocoutE(nullptr,InputArguments) << "HypoTestInverter::RefineScan - run a scan with at least two points first\n";
+      return false;
+   }
+   if (nPoints <= 0) {
+      oocoutE(nullptr,InputArguments) << "HypoTestInverter::RefineScan - Please provide nPoints>0\n";
+      return false;
+   }
 
-      const bool status = RunOnePoint(thisX);
+   const double target = 1. - fResults->ConfidenceLevel();
+
+   for (int iter = 0; iter < nIterations; ++iter) {
+      const int n = fResults->ArraySize();
+      std::vector<unsigned int> index(n);
+      TMath::SortItr(fResults->fXValues.begin(), fResults->fXValues.end(), index.begin(), false);
+
+      std::vector<double> xValues;
+      for (int i = 0; i + 1 < n; ++i) {
+         const double x1 = fResults->GetXValue(index[i]);
+         const double x2 = fResults->GetXValue(index[i + 1]);
+         const double y1 = fResults->GetYValue(index[i]);
+         const double y2 = fResults->GetYValue(index[i + 1]);
+         if ((y1 - target) * (y2 - target) >= 0. || x1 == x2)
+            continue;
+         for (int j = 1; j <= nPoints; ++j)
+            xValues.push_back(x1 + j * (x2 - x1) / (nPoints + 1));
+      }
 
-      // check if failed status
-      if ( status==false ) {
-        oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << thisX << " failed. Skipping." << std::endl;
+      if (xValues.empty()) {
+         oocoutW(nullptr,Eval) << "HypoTestInverter::RefineScan - the scanned points do not cross the target "
+                               << target << std::endl;
+         return iter > 0;
       }
+
+      oocoutI(nullptr,Eval) << "HypoTestInverter::RefineScan - iteration " << iter << ": running "
+                            << xValues.size() << " new points" << std::endl;
+      RunPoints(xValues);
+
+      // the limits have to be computed again with the new points
+      fResults->fLowerLimit = TMath::QuietNaN();
+      fResults->fUpperLimit = TMath::QuietNaN();
    }
 
    return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Run the hypothesis tests at the given points, in several processes if SetNWorkers was used.
+/// The points are clamped to the range of the scanned variable. Failed points are skipped.
+
+void HypoTestInverter::RunPoints(const std::vector<double> &points) const
+{
+   // the points are recorded at the values that are actually tested
+   std::vector<double> xValues;
+   xValues.reserve(points.size());
+   for (double x : points)
+      xValues.push_back(ClampToRange(x));
+
+#ifdef R__WIN32
+   if (fNWorkers > 1) {
+      oocoutW(nullptr,InputArguments) << "HypoTestInverter::RunPoints - running the points in several processes is "
+                                         "not supported on Windows, running sequentially." << std::endl;
+   }
+   const bool sequential = true;
+#else
+   const bool sequential = fNWorkers <= 1 || xValues.size() <= 1;
+#endif
+
+   if (sequential) {
+      for (double x : xValues) {
+         if (!RunOnePoint(x)) {
+            oocoutW(nullptr,Eval) << "HypoTestInverter::RunPoints - The hypo test for point " << x << " failed. Skipping." << std::endl;
+         }
+      }
+      return;
+   }
+
+#ifndef R__WIN32
+   CreateResults();
+
+   // seed every point separately, so that the toys don't depend on the number of workers
+   const UInt_t baseSeed = 1 + RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max() - xValues.size());
+
+   oocoutP(nullptr,Eval) << "HypoTestInverter::RunPoints - running " << xValues.size() << " points with "
+                         << fNWorkers << " worker processes" << std::endl;
+
+   // Executed in the worker processes, on their own copy of the models and of the calculator.
+   // The result is wrapped in a list named after the point index, to restore the order of the points.
+   auto work = [&](unsigned int iPoint) {
+      RooRandom::randomGenerator()->SetSeed(baseSeed + iPoint);
+      auto output = new TList;
+      output->SetName(std::to_string(iPoint).c_str());
+      output->SetOwner();
+      if (HypoTestResult *result = EvalPoint(xValues[iPoint], false, -1))
+         output->Add(result);
+      return output;
+   };
+
+   const double oldValue = fScannedVariable->getVal();
+
+   ROOT::TProcessExecutor pool(std::min<std::size_t>(fNWorkers, xValues.size()));
+   std::vector<TList *> outputs = pool.Map(work, ROOT::TSeq<unsigned int>(xValues.size()));
+   outputs.erase(std::remove(outputs.begin(), outputs.end(), nullptr), outputs.end());
+   std::sort(outputs.begin(), outputs.end(),
+             [](TList *a, TList *b) { return std::stoul(a->GetName()) < std::stoul(b->GetName()); });
+
+   std::vector<bool> done(xValues.size(), false);
+   for (TList *output : outputs) {
+      const unsigned int iPoint = std::stoul(output->GetName());
+      auto result = static_cast<HypoTestResult *>(output->First());
+      if (result) {
+         output->Remove(result);
+         if (fCalcType == kFrequentist || fCalcType == kHybrid)
+            fTotalToysRun += (result->GetAltDistribution()->GetSize() + result->GetNullDistribution()->GetSize());
+         done[iPoint] = AddPointResult(xValues[iPoint], std::unique_ptr<HypoTestResult>(result));
+      }
+      delete output;
+   }
+
+   for (std::size_t i = 0; i < xValues.size(); ++i) {
+      if (!done[i]) {
+         oocoutW(nullptr,Eval) << "HypoTestInverter::RunPoints - The hypo test for point " << xValues[i] << " failed. Skipping." << std::endl;
+      }
+   }
+
+   fScannedVariable->setVal(oldValue);
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// run only one point at the given POI value
 
@@ -678,9 +834,33 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
 
    CreateResults();
 
+   rVal = ClampToRange(rVal);
+
+   // save old value
+   double oldValue = fScannedVariable->getVal();
+
+   // compute the results
+   std::unique_ptr<HypoTestResult> result( EvalPoint(rVal,adaptive,clTarget) );
+   if (!result) {
+      return false;
+   }
+
+   const bool status = AddPointResult(rVal, std::move(result));
+
+   fScannedVariable->setVal(oldValue);
+
+   return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the point clamped to the range of the scanned variable, printing a message
+/// when it was out of range
+
+double HypoTestInverter::ClampToRange( double rVal) const
+{
    // check if rVal is in the range specified for fScannedVariable
    if ( rVal < fScannedVariable->getMin() ) {
-      oocoutE(nullptr,InputArguments) << "HypoTestInverter::RunOnePoint - Out of range: using the lower bound "
+      oocoutE(nullptr,InputArguments) << "HypoTestInverter - Out of range: using the lower bound "
                                           << fScannedVariable->getMin()
                                           << " on the scanned variable rather than " << rVal<< "\n";
      rVal = fScannedVariable->getMin();
@@ -688,16 +868,22 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    if ( rVal > fScannedVariable->getMax() ) {
       // print a message when you have a significative difference since rval is computed
      if (rVal > fScannedVariable->getMax() * (1. + 1.E-12)) {
-        oocoutE(nullptr, InputArguments) << "HypoTestInverter::RunOnePoint - Out of range: using the upper bound "
+        oocoutE(nullptr, InputArguments) << "HypoTestInverter - Out of range: using the upper bound "
                                          << fScannedVariable->getMax() << " on the scanned variable rather than "
                                          << rVal << "\n";
      }
      rVal = fScannedVariable->getMax();
    }
 
-   // save old value
-   double oldValue = fScannedVariable->getVal();
+   return rVal;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the POI to the given value in the null model snapshot and run the hypothesis test
+/// (internal function called by RunOnePoint and RunPoints)
 
+HypoTestResult * HypoTestInverter::EvalPoint( double rVal, bool adaptive, double clTarget) const
+{
    // evaluate hybrid calculator at a single point
    fScannedVariable->setVal(rVal);
    // need to set value of rval in hybridcalculator
@@ -712,18 +898,26 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
       oocoutP(nullptr,Eval) << "Running for " << fScannedVariable->GetName() << " = " << fScannedVariable->getVal() << endl;
 
    // compute the results
-   std::unique_ptr<HypoTestResult> result( Eval(*fCalculator0,adaptive,clTarget) );
+   HypoTestResult * result = Eval(*fCalculator0,adaptive,clTarget);
    if (!result) {
       oocoutE(nullptr,Eval) << "HypoTestInverter - Error running point " << fScannedVariable->GetName() << " = " <<
    fScannedVariable->getVal() << endl;
-      return false;
    }
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the result of the hypothesis test at the given point to the HypoTestInverterResult.
+/// Invalid results are skipped, and a result for the same point as the last one is merged with it.
+
+bool HypoTestInverter::AddPointResult( double rVal, std::unique_ptr<HypoTestResult> result) const
+{
    // in case of a dummy result
    const double nullPV = result->NullPValue();
    const double altPV = result->AlternatePValue();
    if (!std::isfinite(nullPV) || nullPV < 0. || nullPV > 1. || !std::isfinite(altPV) || altPV < 0. || altPV > 1.) {
       oocoutW(nullptr,Eval) << "HypoTestInverter - Skipping invalid result for  point " << fScannedVariable->GetName() << " = " <<
-         fScannedVariable->getVal() << ". null p-value=" << nullPV << ", alternate p-value=" << altPV << endl;
+         rVal << ". null p-value=" << nullPV << ", alternate p-value=" << altPV << endl;
       return false;
    }
 
@@ -757,8 +951,6 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
 
    }
 
-   fScannedVariable->setVal(oldValue);
-
    return true;
 }
 
@@ -45,6 +45,10 @@ ConfInterval pointer).
 This calculator can work with both one-dimensional intervals or multi-
 dimensional ones (contours).
 
+For one or two parameters of interest, GetProfileLikelihoodScan() returns the profile likelihood ratio
+evaluated on a grid of points, computed optionally in several processes. Starting from the best fit values,
+each point is fitted starting from the parameter values found at the neighbouring point.
+
 Note that for hypothesis tests, it is often better to use the
 AsymptoticCalculator, which can compute in addition the expected
 \f$p\f$-value using an Asimov data set.
@@ -63,11 +67,23 @@ AsymptoticCalculator, which can compute in addition the expected
 #include "RooProfileLL.h"
 #include "RooGlobalFunc.h"
 #include "RooMsgService.h"
+#include "RooNumber.h"
 
 #include "Math/MinimizerOptions.h"
 #include "RooMinimizer.h"
 //#include "RooProdPdf.h"
 
+#include "TH1.h"
+#include "TH2.h"
+
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+#include <vector>
+
 using std::cout, std::endl;
 
 ClassImp(RooStats::ProfileLikelihoodCalculator);
@@ -397,3 +413,165 @@ HypoTestResult* ProfileLikelihoodCalculator::GetHypoTest() const {
    return htr;
 
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Scan the profile likelihood ratio \f$ -2 \ln \lambda \f$ in the range of the parameters of interest.
+/// A global fit is performed first, and then the likelihood is minimized at every point of a grid of nPoints
+/// values (bin centres) per parameter of interest, with the parameters of interest fixed.
+///
+/// The grid is split in rows going away from the best fit value. Along a row, the fit of each point starts
+/// from the values of the parameters found at the previous point, which speeds up the convergence. With
+/// nWorkers > 1, the rows are fitted in parallel in nWorkers processes (each working on its own copy of the
+/// likelihood); for a single parameter of interest the grid is split in nWorkers rows.
+///
+/// \param[in] nPoints Number of grid points per parameter of interest.
+/// \param[in] nWorkers Number of processes.
+/// \return A TH1D (one parameter of interest) or TH2D (two parameters of interest) owned by the caller, filled with
+/// \f$ -2 \ln \lambda \f$ at every bin centre, or nullptr in case of errors.
+
+TH1* ProfileLikelihoodCalculator::GetProfileLikelihoodScan(int nPoints, unsigned int nWorkers) const {
+   RooAbsPdf * pdf = GetPdf();
+   RooAbsData* data = GetData();
+   if (!data || !pdf || nPoints <= 0) return nullptr;
+
+   if (fPOI.empty() || fPOI.size() > 2) {
+      oocoutE(nullptr,InputArguments) << "ProfileLikelihoodCalculator::GetProfileLikelihoodScan - only scans of one or two "
+                                      << "parameters of interest are supported" << std::endl;
+      return nullptr;
+   }
+
+   // do a global fit
+   std::unique_ptr<RooAbsReal> nll{DoGlobalFit()};
+   if (!nll || !fFitResult) return nullptr;
+
+   std::unique_ptr<RooArgSet> params{pdf->getParameters(*data)};
+   RooArgSet oldValues;
+   params->snapshot(oldValues);
+
+   std::vector<RooRealVar *> pois;
+   for (auto const *arg : fPOI) {
+      auto poi = dynamic_cast<RooRealVar *>(params->find(arg->GetName()));
+      if (!poi || RooNumber::isInfinite(poi->getMin()) || RooNumber::isInfinite(poi->getMax())) {
+         oocoutE(nullptr,InputArguments) << "ProfileLikelihoodCalculator::GetProfileLikelihoodScan - the parameter of interest "
+                                         << arg->GetName() << " is not a parameter of the model with a finite range" << std::endl;
+         return nullptr;
+      }
+      pois.push_back(poi);
+   }
+
+   // the grid, using the bin centres
+   std::unique_ptr<TH1> hist;
+   if (pois.size() == 1) {
+      hist = std::make_unique<TH1D>("ProfileLikelihoodScan",
+                                    TString::Format("Profile likelihood scan;%s;-2 log #lambda", pois[0]->GetTitle()),
+                                    nPoints, pois[0]->getMin(), pois[0]->getMax());
+   } else {
+      hist = std::make_unique<TH2D>("ProfileLikelihoodScan",
+                                    TString::Format("Profile likelihood scan;%s;%s;-2 log #lambda",
+                                                    pois[0]->GetTitle(), pois[1]->GetTitle()),
+                                    nPoints, pois[0]->getMin(), pois[0]->getMax(), nPoints, pois[1]->getMin(),
+                                    pois[1]->getMax());
+   }
+   hist->SetDirectory(nullptr);
+
+   // split the grid in rows of points going away from the best fit value
+   const RooArgList &fitParams = fFitResult->floatParsFinal();
+   auto bestFitPoi = static_cast<RooRealVar *>(fitParams.find(pois[0]->GetName()));
+   const int bestBin = std::clamp(hist->GetXaxis()->FindFixBin(bestFitPoi ? bestFitPoi->getVal() : pois[0]->getVal()), 1, nPoints);
+   const int nRows = pois.size() == 1 ? 1 : nPoints;
+   const int nChunks = pois.size() == 1 ? std::clamp<int>(nWorkers, 1, nPoints) : 1;
+   std::vector<std::vector<int>> tasks;
+   auto addRow = [&](int iy, int first, int last, int step) {
+      tasks.emplace_back();
+      for (int ix = first; ix != last + step; ix += step)
+         tasks.back().push_back(hist->GetBin(ix, iy));
+   };
+   for (int iy = (pois.size() == 1 ? 0 : 1); iy <= (pois.size() == 1 ? 0 : nRows); ++iy) {
+      for (int iChunk = 0; iChunk < nChunks; ++iChunk) {
+         const int first = 1 + iChunk * nPoints / nChunks;
+         const int last = (iChunk + 1) * nPoints / nChunks;
+         if (last < bestBin) {
+            addRow(iy, last, first, -1);
+         } else if (first > bestBin) {
+            addRow(iy, first, last, 1);
+         } else {
+            addRow(iy, bestBin, last, 1);
+            if (first < bestBin)
+               addRow(iy, bestBin - 1, first, -1);
+         }
+      }
+   }
+
+   double nLLatMLE = fFitResult->minNll();
+   // in case of using offset need to save offset value
+   params->assign(fitParams);
+   double nlloffset = (RooStats::IsNLLOffset() ) ? nll->getVal() - nLLatMLE : 0;
+
+   for (auto poi : pois)
+      poi->setConstant(true);
+   bool existVarParams = false;
+   for (auto const *arg : *params) {
+      if (!arg->isConstant()) {
+         existVarParams = true;
+         break;
+      }
+   }
+
+   // fit the points of one row, starting from the global fit values
+   auto runRow = [&](const std::vector<int> &bins, TH1 &output) {
+      params->assign(fitParams);
+      for (int bin : bins) {
+         int ix, iy, iz;
+         output.GetBinXYZ(bin, ix, iy, iz);
+         pois[0]->setVal(output.GetXaxis()->GetBinCenter(ix));
+         if (pois.size() == 2)
+            pois[1]->setVal(output.GetYaxis()->GetBinCenter(iy));
+
+         double nLLatCondMLE = nLLatMLE;
+         if (existVarParams) {
+            std::unique_ptr<RooFitResult> fit{DoMinimizeNLL(&*nll)};
+            if (!fit) continue;
+            nLLatCondMLE = fit->minNll();
+            if (fit->status() != 0)
+               oocoutW(nullptr,Minimization) << "ProfileLikelihoodCalcultor::GetProfileLikelihoodScan - Conditional fit failed - status = "
+                                             << fit->status() << std::endl;
+         } else {
+            nLLatCondMLE = nll->getVal() - nlloffset;
+         }
+         output.SetBinContent(bin, 2 * std::max(nLLatCondMLE - nLLatMLE, 0.));
+      }
+   };
+
+#ifndef R__WIN32
+   if (nWorkers > 1 && tasks.size() > 1) {
+      auto work = [&](unsigned int iTask) {
+         auto output = static_cast<TH1 *>(hist->Clone());
+         output->SetDirectory(nullptr);
+         runRow(tasks[iTask], *output);
+         return output;
+      };
+      ROOT::TProcessExecutor pool(std::min<std::size_t>(nWorkers, tasks.size()));
+      // every point is filled by exactly one of the outputs
+      for (TH1 *output : pool.Map(work, ROOT::TSeq<unsigned int>(tasks.size()))) {
+         if (output) hist->Add(output);
+         delete output;
+      }
+   } else
+#else
+   if (nWorkers > 1) {
+      oocoutW(nullptr,InputArguments) << "ProfileLikelihoodCalculator::GetProfileLikelihoodScan - running in several "
+                                      << "processes is not supported on Windows, running sequentially" << std::endl;
+   }
+#endif
+   {
+      for (auto const &bins : tasks) runRow(bins, *hist);
+   }
+
+   // restore the parameters
+   params->assign(oldValues);
+   for (auto poi : pois)
+      poi->setConstant(static_cast<RooAbsArg &>(oldValues[poi->GetName()]).isConstant());
+
+   return hist.release();
+}
+
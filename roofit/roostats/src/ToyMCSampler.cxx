@@ -24,7 +24,13 @@ ToyMCSampler is an implementation of the TestStatSampler interface.
 It generates Toy Monte Carlo for a given parameter point and evaluates a
 TestStatistic.
 
-For parallel runs, ToyMCSampler can be given an instance of ProofConfig
+For parallel runs on the local machine, use SetNWorkers() to generate and
+evaluate the toys in several forked processes with ROOT::TProcessExecutor.
+The toys are split in tasks of a fixed number of toys, and the random generator
+is seeded separately for each task, so the results don't depend on the number
+of workers.
+
+Alternatively, ToyMCSampler can be given an instance of ProofConfig
 and then run in parallel using proof or proof-lite. Internally, it uses
 ToyMCStudy with the RooStudyManager.
 */
@@ -50,6 +56,14 @@ ToyMCStudy with the RooStudyManager.
 
 #include "TMath.h"
 
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+#include <string>
+
 
 using namespace RooFit;
 using std::endl;
@@ -267,8 +281,11 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 {
 
    // ======= S I N G L E   R U N ? =======
-   if(!fProofConfig)
+   if(!fProofConfig) {
+      if (fNWorkers > 1)
+         return GetSamplingDistributionsMultiProcess(paramPointIn);
       return GetSamplingDistributionsSingleWorker(paramPointIn);
+   }
 
    // ======= P A R A L L E L   R U N =======
    if (!CheckConfig()){
@@ -310,6 +327,86 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the toys in fNWorkers forked processes. Called from
+/// GetSamplingDistributions() when SetNWorkers() was used. Each task runs
+/// GetSamplingDistributionsSingleWorker() for fNToysPerTask toys, with a random
+/// seed that depends only on the task index. The outputs of the tasks are merged
+/// in the order of the tasks.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsMultiProcess(RooArgSet& paramPointIn)
+{
+#ifdef R__WIN32
+   oocoutW(nullptr, InputArguments)
+      << "ToyMCSampler: running the toys in several processes is not supported on Windows, running sequentially."
+      << endl;
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   if (!CheckConfig()){
+      oocoutE(nullptr, InputArguments)
+         << "Bad COnfiguration in ToyMCSampler "
+         << endl;
+      return nullptr;
+   }
+
+   if(fToysInTails) {
+      oocoutW(nullptr, InputArguments)
+         << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+         << endl;
+   }
+
+   const Int_t totToys = fMaxToys < fNToys ? static_cast<Int_t>(fMaxToys) : fNToys;
+   const Int_t nTasks = (totToys + fNToysPerTask - 1) / fNToysPerTask;
+   if (nTasks <= 0)
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+
+   const UInt_t baseSeed = 1 + RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max() - nTasks);
+
+   oocoutP(nullptr, Generation) << "ToyMCSampler: generating " << totToys << " toys in " << nTasks << " tasks with "
+                                << fNWorkers << " worker processes" << endl;
+
+   // Executed in the worker processes, on their own copy of this ToyMCSampler
+   auto work = [&](Int_t iTask) {
+      fNToys = std::min(fNToysPerTask, totToys - iTask * fNToysPerTask);
+      fToysInTails = 0.0;
+      // the nuisance parameter points are generated anew for each task
+      SetPriorNuisance(fPriorNuisance);
+      RooRandom::randomGenerator()->SetSeed(baseSeed + iTask);
+
+      RooDataSet *output = GetSamplingDistributionsSingleWorker(paramPointIn);
+      // the title is used to merge the outputs in the right order
+      if (output)
+         output->SetTitle(std::to_string(iTask).c_str());
+      return output;
+   };
+
+   ROOT::TProcessExecutor pool(fNWorkers);
+   std::vector<RooDataSet *> results = pool.Map(work, ROOT::TSeq<Int_t>(nTasks));
+   results.erase(std::remove(results.begin(), results.end(), nullptr), results.end());
+   if (static_cast<Int_t>(results.size()) != nTasks) {
+      oocoutE(nullptr, Generation) << "ToyMCSampler: only " << results.size() << " of " << nTasks
+                                   << " tasks were processed successfully" << endl;
+   }
+   if (results.empty())
+      return nullptr;
+
+   // the results arrive in any order
+   std::sort(results.begin(), results.end(), [](RooDataSet *a, RooDataSet *b) {
+      return std::stoi(a->GetTitle()) < std::stoi(b->GetTitle());
+   });
+
+   // append the outputs one by one to the first one, to not keep the copies around
+   RooDataSet *output = results.front();
+   for (std::size_t i = 1; i < results.size(); ++i) {
+      if (results[i]->numEntries() > 0)
+         output->append(*results[i]);
+      delete results[i];
+   }
+   output->SetNameTitle(fSamplingDistName.c_str(), fSamplingDistName.c_str());
+   return output;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
@@ -0,0 +1,238 @@
+// Tests for the RooStats::HypoTestInverter
+
+#include "RooDataSet.h"
+#include "RooHelpers.h"
+#include "RooRandom.h"
+#include "RooRealVar.h"
+#include "RooWorkspace.h"
+#include "RooStats/AsymptoticCalculator.h"
+#include "RooStats/FrequentistCalculator.h"
+#include "RooStats/HypoTestInverter.h"
+#include "RooStats/HypoTestInverterResult.h"
+#include "RooStats/ModelConfig.h"
+#include "RooStats/ProfileLikelihoodTestStat.h"
+#include "RooStats/SamplingDistribution.h"
+#include "RooStats/ToyMCSampler.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <utility>
+
+namespace {
+
+// Counting experiment with signal strength mu, 5 expected signal and 3 expected background events,
+// and 5 observed events
+class CountingModel {
+public:
+   CountingModel() : fWs("w"), fSbModel("S+B", &fWs), fBModel("B", &fWs)
+   {
+      fWs.factory("Poisson::pois(n[5,0,100], sum::nexp(prod::sig(mu[1,0,10], s[5]), b[3]))");
+      fWs.var("s")->setConstant();
+      fWs.var("b")->setConstant();
+
+      RooRealVar &n = *fWs.var("n");
+      fData = std::make_unique<RooDataSet>("data", "data", n);
+      fData->add(n);
+
+      RooRealVar &mu = *fWs.var("mu");
+      fSbModel.SetPdf("pois");
+      fSbModel.SetObservables(n);
+      fSbModel.SetParametersOfInterest(mu);
+      mu.setVal(1.);
+      fSbModel.SetSnapshot(mu);
+
+      fBModel.SetPdf("pois");
+      fBModel.SetObservables(n);
+      fBModel.SetParametersOfInterest(mu);
+      mu.setVal(0.);
+      fBModel.SetSnapshot(mu);
+   }
+
+   RooDataSet &Data() { return *fData; }
+   RooStats::ModelConfig &SbModel() { return fSbModel; }
+   RooStats::ModelConfig &BModel() { return fBModel; }
+
+private:
+   RooWorkspace fWs;
+   RooStats::ModelConfig fSbModel;
+   RooStats::ModelConfig fBModel;
+   std::unique_ptr<RooDataSet> fData;
+};
+
+// Run a fixed scan with the asymptotic calculator
+std::unique_ptr<RooStats::HypoTestInverterResult>
+RunAsymptoticScan(CountingModel &model, unsigned int nWorkers, int nPoints, double xMin, double xMax)
+{
+   RooStats::AsymptoticCalculator calc(model.Data(), model.BModel(), model.SbModel());
+   calc.SetOneSided(true);
+   RooStats::HypoTestInverter inverter(calc);
+   inverter.SetConfidenceLevel(0.95);
+   inverter.UseCLs(true);
+   inverter.SetNWorkers(nWorkers);
+   inverter.RunFixedScan(nPoints, xMin, xMax);
+   return std::unique_ptr<RooStats::HypoTestInverterResult>{inverter.GetInterval()};
+}
+
+// Return the two neighbouring scanned points between which the CLs curve crosses the target
+std::pair<double, double> BracketUpperLimit(const RooStats::HypoTestInverterResult &result, double target)
+{
+   std::pair<double, double> bracket{0., 0.};
+   bool hasLow = false;
+   bool hasHigh = false;
+   for (int i = 0; i < result.ArraySize(); ++i) {
+      const double x = result.GetXValue(i);
+      if (result.GetYValue(i) > target && (!hasLow || x > bracket.first)) {
+         bracket.first = x;
+         hasLow = true;
+      }
+      if (result.GetYValue(i) <= target && (!hasHigh || x < bracket.second)) {
+         bracket.second = x;
+         hasHigh = true;
+      }
+   }
+   return bracket;
+}
+
+void ExpectSamePoints(const RooStats::HypoTestInverterResult &result, const RooStats::HypoTestInverterResult &ref)
+{
+   ASSERT_EQ(result.ArraySize(), ref.ArraySize());
+   for (int i = 0; i < ref.ArraySize(); ++i) {
+      EXPECT_DOUBLE_EQ(result.GetXValue(i), ref.GetXValue(i)) << "point " << i;
+      EXPECT_DOUBLE_EQ(result.CLs(i), ref.CLs(i)) << "point " << i;
+      EXPECT_DOUBLE_EQ(result.CLsplusb(i), ref.CLsplusb(i)) << "point " << i;
+   }
+}
+
+} // namespace
+
+// The points of a fixed scan evaluated in several processes must be the same as the sequential ones
+TEST(HypoTestInverter, ParallelFixedScan)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+   RooStats::AsymptoticCalculator::SetPrintLevel(-1);
+
+   CountingModel model;
+   auto result1 = RunAsymptoticScan(model, 1, 11, 0., 2.);
+   auto result3 = RunAsymptoticScan(model, 3, 11, 0., 2.);
+   ASSERT_NE(result1, nullptr);
+   ASSERT_NE(result3, nullptr);
+   EXPECT_EQ(result1->ArraySize(), 11);
+   ExpectSamePoints(*result3, *result1);
+   EXPECT_DOUBLE_EQ(result3->UpperLimit(), result1->UpperLimit());
+}
+
+// The points of a log scan up to the bound of the scanned variable can exceed it by rounding. They are clamped
+// to the range and recorded at the tested values, also when they are evaluated in several processes.
+TEST(HypoTestInverter, ParallelLogScanAtBound)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+   RooStats::AsymptoticCalculator::SetPrintLevel(-1);
+
+   CountingModel model;
+   auto runScan = [&](unsigned int nWorkers) {
+      RooStats::AsymptoticCalculator calc(model.Data(), model.BModel(), model.SbModel());
+      calc.SetOneSided(true);
+      RooStats::HypoTestInverter inverter(calc);
+      inverter.UseCLs(true);
+      inverter.SetNWorkers(nWorkers);
+      inverter.RunFixedScan(7, 0.3, 10., true);
+      return std::unique_ptr<RooStats::HypoTestInverterResult>{inverter.GetInterval()};
+   };
+
+   auto result1 = runScan(1);
+   auto result3 = runScan(3);
+   ASSERT_EQ(result1->ArraySize(), 7);
+   ExpectSamePoints(*result3, *result1);
+   for (int i = 0; i < result3->ArraySize(); ++i) {
+      EXPECT_LE(result3->GetXValue(i), 10.) << "point " << i;
+   }
+}
+
+// With toys, every point is seeded separately, so the results don't depend on the number of workers
+TEST(HypoTestInverter, ParallelFixedScanToys)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   CountingModel model;
+   constexpr int nToysNull = 60;
+   constexpr int nToysAlt = 30;
+
+   auto runScan = [&](unsigned int nWorkers) {
+      RooStats::FrequentistCalculator calc(model.Data(), model.BModel(), model.SbModel());
+      calc.SetToys(nToysNull, nToysAlt);
+      RooStats::ProfileLikelihoodTestStat testStat(*model.SbModel().GetPdf());
+      testStat.SetOneSided(true);
+      auto sampler = static_cast<RooStats::ToyMCSampler *>(calc.GetTestStatSampler());
+      sampler->SetTestStatistic(&testStat);
+      sampler->SetNEventsPerToy(1);
+
+      RooStats::HypoTestInverter inverter(calc);
+      inverter.SetConfidenceLevel(0.95);
+      inverter.UseCLs(true);
+      inverter.SetNWorkers(nWorkers);
+      RooRandom::randomGenerator()->SetSeed(4357);
+      inverter.RunFixedScan(4, 0.5, 2.);
+      return std::unique_ptr<RooStats::HypoTestInverterResult>{inverter.GetInterval()};
+   };
+
+   auto result2 = runScan(2);
+   auto result3 = runScan(3);
+   ASSERT_NE(result2, nullptr);
+   ASSERT_NE(result3, nullptr);
+   ASSERT_EQ(result2->ArraySize(), 4);
+   ExpectSamePoints(*result3, *result2);
+
+   // all the toys are sent back from the workers
+   for (int i = 0; i < result3->ArraySize(); ++i) {
+      EXPECT_EQ(result3->GetResult(i)->GetNullDistribution()->GetSize(), nToysNull) << "point " << i;
+      EXPECT_EQ(result3->GetResult(i)->GetAltDistribution()->GetSize(), nToysAlt) << "point " << i;
+   }
+}
+
+// RefineScan adds points around the upper limit and narrows the interval enclosing it
+TEST(HypoTestInverter, RefineScan)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+   RooStats::AsymptoticCalculator::SetPrintLevel(-1);
+
+   CountingModel model;
+   const double target = 0.05;
+
+   // reference upper limit from a fine scan
+   auto fineResult = RunAsymptoticScan(model, 1, 201, 0., 4.);
+   const double refLimit = fineResult->UpperLimit();
+
+   RooStats::AsymptoticCalculator calc(model.Data(), model.BModel(), model.SbModel());
+   calc.SetOneSided(true);
+   RooStats::HypoTestInverter inverter(calc);
+   inverter.SetConfidenceLevel(0.95);
+   inverter.UseCLs(true);
+   inverter.SetNWorkers(2);
+   inverter.RunFixedScan(5, 0., 4.);
+
+   std::unique_ptr<RooStats::HypoTestInverterResult> coarse{inverter.GetInterval()};
+   const auto coarseBracket = BracketUpperLimit(*coarse, target);
+   ASSERT_LT(coarseBracket.first, refLimit);
+   ASSERT_GT(coarseBracket.second, refLimit);
+
+   constexpr int nPoints = 4;
+   constexpr int nIterations = 2;
+   ASSERT_TRUE(inverter.RefineScan(nPoints, nIterations));
+
+   std::unique_ptr<RooStats::HypoTestInverterResult> refined{inverter.GetInterval()};
+   EXPECT_EQ(refined->ArraySize(), coarse->ArraySize() + nIterations * nPoints);
+
+   // the new points bracket the upper limit more closely
+   const auto refinedBracket = BracketUpperLimit(*refined, target);
+   EXPECT_LE(refinedBracket.first, refLimit);
+   EXPECT_GE(refinedBracket.second, refLimit);
+   EXPECT_NEAR(refinedBracket.second - refinedBracket.first,
+               (coarseBracket.second - coarseBracket.first) / ((nPoints + 1) * (nPoints + 1)), 1e-9);
+
+   // the cached limit was reset, and the new one is computed from the new points
+   const double refinedLimit = refined->UpperLimit();
+   EXPECT_GE(refinedLimit, refinedBracket.first);
+   EXPECT_LE(refinedLimit, refinedBracket.second);
+   EXPECT_NEAR(refinedLimit, refLimit, 0.01);
+}
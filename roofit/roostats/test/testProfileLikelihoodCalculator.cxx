@@ -0,0 +1,48 @@
+// Tests for the RooStats::ProfileLikelihoodCalculator
+
+#include "RooDataSet.h"
+#include "RooGaussian.h"
+#include "RooRealVar.h"
+#include "RooStats/ProfileLikelihoodCalculator.h"
+
+#include "TH1.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+
+// For a Gaussian with floating mean and width, the profile likelihood ratio of the mean is known analytically:
+// -2 log lambda(m) = N log(1 + (m - mhat)^2 / shat^2)
+TEST(ProfileLikelihoodCalculator, ProfileLikelihoodScan)
+{
+   RooRealVar x("x", "x", 0, -100, 100);
+   RooRealVar m("m", "m", 0, -0.3, 0.3);
+   RooRealVar s("s", "s", 1, 0.1, 10);
+   RooGaussian gauss("gauss", "gauss", x, m, s);
+
+   const int nEvents = 1000;
+   std::unique_ptr<RooDataSet> data{gauss.generate(x, nEvents)};
+   const double mhat = data->mean(x);
+   const double shat2 = data->moment(x, 2, mhat);
+
+   RooStats::ProfileLikelihoodCalculator plc(*data, gauss, m);
+   std::unique_ptr<TH1> scan{plc.GetProfileLikelihoodScan(7)};
+   ASSERT_NE(scan, nullptr);
+   ASSERT_EQ(scan->GetDimension(), 1);
+
+   for (int i = 1; i <= scan->GetNbinsX(); ++i) {
+      const double mi = scan->GetBinCenter(i);
+      EXPECT_NEAR(scan->GetBinContent(i), nEvents * std::log(1 + (mi - mhat) * (mi - mhat) / shat2), 1.E-2)
+         << "at m = " << mi;
+   }
+
+#ifndef R__WIN32
+   // the parallel scan has to give the same results
+   std::unique_ptr<TH1> scanMP{plc.GetProfileLikelihoodScan(7, 3)};
+   ASSERT_NE(scanMP, nullptr);
+   for (int i = 1; i <= scan->GetNbinsX(); ++i) {
+      EXPECT_NEAR(scanMP->GetBinContent(i), scan->GetBinContent(i), 1.E-3) << "at m = " << scan->GetBinCenter(i);
+   }
+#endif
+}
@@ -0,0 +1,60 @@
+// Tests for the RooStats::ToyMCSampler
+
+#include "RooGaussian.h"
+#include "RooHelpers.h"
+#include "RooRandom.h"
+#include "RooRealVar.h"
+#include "RooStats/ProfileLikelihoodTestStat.h"
+#include "RooStats/SamplingDistribution.h"
+#include "RooStats/ToyMCSampler.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+
+// The toys generated in several processes are seeded per task, so the sampling distribution
+// doesn't depend on the number of workers
+TEST(ToyMCSampler, MultiProcess)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x("x", "x", -10., 10.);
+   RooRealVar mu("mu", "mu", 0., -5., 5.);
+   RooRealVar sigma("sigma", "sigma", 1.);
+   RooGaussian gauss("gauss", "gauss", x, mu, sigma);
+
+   RooStats::ProfileLikelihoodTestStat testStat(gauss);
+   constexpr int nToys = 30;
+   // the last task has fewer toys
+   constexpr int nToysPerTask = 7;
+
+   auto runToys = [&](unsigned int nWorkers) {
+      RooStats::ToyMCSampler sampler(testStat, nToys);
+      sampler.SetPdf(gauss);
+      sampler.SetObservables(x);
+      sampler.SetParametersForTestStat(mu);
+      sampler.SetNEventsPerToy(50);
+      sampler.SetNWorkers(nWorkers, nToysPerTask);
+
+      mu.setVal(0.);
+      RooArgSet paramPoint(mu);
+      RooRandom::randomGenerator()->SetSeed(42);
+      return std::unique_ptr<RooStats::SamplingDistribution>{sampler.GetSamplingDistribution(paramPoint)};
+   };
+
+   auto dist2 = runToys(2);
+   ASSERT_NE(dist2, nullptr);
+   EXPECT_EQ(dist2->GetSize(), nToys);
+
+   for (unsigned int nWorkers : {3u, 5u}) {
+      SCOPED_TRACE(std::to_string(nWorkers) + " workers");
+      auto dist = runToys(nWorkers);
+      ASSERT_NE(dist, nullptr);
+      ASSERT_EQ(dist->GetSize(), nToys);
+      for (int i = 0; i < nToys; ++i) {
+         EXPECT_EQ(dist->GetSamplingDistribution()[i], dist2->GetSamplingDistribution()[i]) << "toy " << i;
+         EXPECT_EQ(dist->GetSampleWeights()[i], dist2->GetSampleWeights()[i]) << "toy " << i;
+      }
+   }
+}
@@ -48,23 +48,26 @@ private:
    std::unique_ptr<ROOT::Internal::RRawFile> fCsvFile;
    const char fDelimiter;
    const Long64_t fLinesChunkSize;
-   ULong64_t fEntryRangesRequested = 0ULL;
+   ULong64_t fChunkFirstEntry = 0ULL; // global entry number of the first record of the current chunk
    ULong64_t fProcessedLines = 0ULL; // marks the progress of the consumption of the csv lines
    std::vector<std::string> fHeaders; // the column names
    std::unordered_map<std::string, ColType_t> fColTypes;
    std::set<std::string> fColContainingEmpty; // store columns which had empty entry
    std::list<ColType_t> fColTypesList; // column types, order is the same as fHeaders, values the same as fColTypes
-   std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot] (same ordering as fHeaders)
-   std::vector<Record_t> fRecords;                         // fRecords[entry][column] (same ordering as fHeaders)
-   std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
-   std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
-   std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
+   std::vector<std::vector<void *>> fColAddresses; // fColAddresses[column][slot] (same ordering as fHeaders)
+   // The records of the current chunk are stored column-wise, e.g. fDoubleRecords[column][record] (same ordering as
+   // fHeaders). For each column, only the vector corresponding to its type is filled.
+   std::vector<std::vector<double>> fDoubleRecords;
+   std::vector<std::vector<Long64_t>> fLong64Records;
+   std::vector<std::vector<std::string>> fStringRecords;
    // This must be a deque to avoid the specialisation vector<bool>. This would not
    // work given that the pointer to the boolean in that case cannot be taken
-   std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
+   std::vector<std::deque<bool>> fBoolRecords;
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   void FillRecords(const std::vector<std::string> &);
+   void FillRecord(const std::string &, std::size_t, std::vector<std::string_view> &, std::vector<std::string> &,
+                   std::vector<char> &);
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &) final;
    void ValidateColTypes(std::vector<std::string> &) const;
@@ -72,6 +75,7 @@ private:
    void InferType(const std::string &, unsigned int);
    std::vector<std::string> ParseColumns(const std::string &);
    size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
+   void SplitColumns(const std::string &, std::vector<std::string_view> &, std::vector<std::string> &);
    ColType_t GetType(std::string_view colName) const;
    void FreeRecords();
 
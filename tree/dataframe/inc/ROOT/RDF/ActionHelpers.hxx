@@ -37,6 +37,7 @@
 #include "TError.h" // for R__ASSERT, Warning
 #include "TFile.h" // for SnapshotHelper
 #include "TH1.h"
+#include "TH2.h"
 #include "TGraph.h"
 #include "TGraphAsymmErrors.h"
 #include "TLeaf.h"
@@ -441,6 +442,17 @@ class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
 #endif
    }
 
+   // true if the inputs are the values (and optionally the weights) of a TH1D or TH2D, all stored in RVecD,
+   // in which case all values can be passed at once to the histogram's FillN
+   template <typename... Xs>
+   static constexpr bool CanFillN()
+   {
+      constexpr auto nArgs = sizeof...(Xs);
+      constexpr bool areRVecD = std::conjunction<std::is_same<Xs, ROOT::RVecD>...>::value;
+      return areRVecD && ((std::is_same<HIST, ::TH1D>::value && (nArgs == 1 || nArgs == 2)) ||
+                          (std::is_same<HIST, ::TH2D>::value && (nArgs == 2 || nArgs == 3)));
+   }
+
    template <std::size_t ColIdx, typename End_t, typename... Its>
    void ExecLoop(unsigned int slot, End_t end, Its... its)
    {
@@ -500,7 +512,17 @@ public:
          }
       }
 
-      ExecLoop<colidx>(slot, xrefend, MakeBegin(xs)...);
+      if constexpr (CanFillN<Xs...>()) {
+         // the pointer after the last input is the (null) weight array if no weights were passed
+         const Double_t *arrays[] = {xs.data()..., nullptr};
+         const auto n = static_cast<Int_t>(sizes[colidx]);
+         if constexpr (std::is_same<HIST, ::TH1D>::value)
+            fObjects[slot]->FillN(n, arrays[0], arrays[1]);
+         else
+            fObjects[slot]->FillN(n, arrays[0], arrays[1], arrays[2]);
+      } else {
+         ExecLoop<colidx>(slot, xrefend, MakeBegin(xs)...);
+      }
    }
 
    template <typename T = HIST>
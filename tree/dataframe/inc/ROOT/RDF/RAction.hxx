@@ -108,8 +108,10 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevNode.CheckFilters(slot, entry))
+      if (fPrevNode.CheckFilters(slot, entry)) {
+         RNodeTimer timer(fProfiler, slot, fProfilerId);
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
    }
 
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
@@ -152,6 +154,8 @@ public:
    /// user-defined callback registered via RResultPtr::RegisterCallback
    void *PartialUpdate(unsigned int slot) final { return fHelper.CallPartialUpdate(slot); }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) final
    {
       const auto nVariations = GetVariations().size();
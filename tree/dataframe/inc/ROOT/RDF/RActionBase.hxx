@@ -12,6 +12,7 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
@@ -42,6 +43,8 @@ protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   RLoopProfiler *fProfiler = nullptr; ///< Non-null only if profiling is enabled for the current event loop.
+   unsigned int fProfilerId = 0;       ///< Identifier of this node in fProfiler.
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -72,6 +75,14 @@ public:
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
    /// user-defined callback registered via RResultPtr::RegisterCallback
    virtual void *PartialUpdate(unsigned int slot) = 0;
+   /// Name of the action, as displayed by SaveGraph.
+   virtual std::string GetActionName() = 0;
+
+   void SetProfiler(RLoopProfiler *profiler, unsigned int id)
+   {
+      fProfiler = profiler;
+      fProfilerId = id;
+   }
 
    // overridden by RJittedAction
    virtual bool HasRun() const { return fHasRun; }
@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
@@ -48,6 +49,8 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   RDFInternal::RLoopProfiler *fProfiler = nullptr; ///< Non-null only if profiling is enabled for the current event loop.
+   unsigned int fProfilerId = 0;                     ///< Identifier of this node in fProfiler.
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -70,6 +73,13 @@ public:
    virtual void FinalizeSlot(unsigned int slot) = 0;
 
    const std::vector<std::string> &GetVariations() const { return fVariationDeps; }
+   const std::string &GetVariation() const { return fVariation; }
+
+   void SetProfiler(RDFInternal::RLoopProfiler *profiler, unsigned int id)
+   {
+      fProfiler = profiler;
+      fProfilerId = id;
+   }
 
    /// Create clones of this Define that work with values in varied "universes".
    virtual void MakeVariations(const std::vector<std::string> &variations) = 0;
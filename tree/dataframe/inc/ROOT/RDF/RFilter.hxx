@@ -96,7 +96,11 @@ public:
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
          } else {
             // evaluate this filter, cache the result
-            auto passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+            bool passed;
+            {
+               RDFInternal::RNodeTimer timer(fProfiler, slot, fProfilerId);
+               passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+            }
             passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
                    : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = passed;
@@ -12,6 +12,7 @@
 #define ROOT_RFILTERBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "ROOT/RVec.hxx"
@@ -48,6 +49,8 @@ protected:
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   RDFInternal::RLoopProfiler *fProfiler = nullptr; ///< Non-null only if profiling is enabled for the current event loop.
+   unsigned int fProfilerId = 0;                     ///< Identifier of this node in fProfiler.
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -72,6 +75,12 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
+   const std::string &GetVariation() const { return fVariation; }
+   void SetProfiler(RDFInternal::RLoopProfiler *profiler, unsigned int id)
+   {
+      fProfiler = profiler;
+      fProfilerId = id;
+   }
 };
 
 } // ns RDF
@@ -89,6 +89,9 @@ class GraphCreatorHelper;
 void ChangeEmptyEntryRange(const ROOT::RDF::RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
 void ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
 void TriggerRun(ROOT::RDF::RNode node);
+void SetShareJittedNodes(const ROOT::RDF::RNode &node, bool share);
+void SetProfiling(const ROOT::RDF::RNode &node, bool enable);
+const RLoopProfiler *GetLoopProfiler(const ROOT::RDF::RNode &node);
 } // namespace RDF
 } // namespace Internal
 
@@ -121,6 +124,9 @@ class RInterface : public RInterfaceBase {
    friend void RDFInternal::TriggerRun(RNode node);
    friend void RDFInternal::ChangeEmptyEntryRange(const RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
    friend void RDFInternal::ChangeSpec(const RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
+   friend void RDFInternal::SetShareJittedNodes(const RNode &node, bool share);
+   friend void RDFInternal::SetProfiling(const RNode &node, bool enable);
+   friend const RDFInternal::RLoopProfiler *RDFInternal::GetLoopProfiler(const RNode &node);
 
    std::shared_ptr<Proxied> fProxiedPtr; ///< Smart pointer to the graph node encapsulated by this RInterface.
 
@@ -54,6 +54,7 @@ public:
    void FinalizeSlot(unsigned int) final;
    void Finalize() final;
    void *PartialUpdate(unsigned int slot) final;
+   std::string GetActionName() final;
    bool HasRun() const final;
    void SetHasRun() final;
 
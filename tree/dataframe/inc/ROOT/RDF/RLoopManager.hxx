@@ -14,6 +14,7 @@
 #include "ROOT/InternalTreeUtils.hxx" // RNoCleanupNotifier
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
@@ -107,6 +108,8 @@ namespace RDFInternal = ROOT::Internal::RDF;
 class RFilterBase;
 class RRangeBase;
 class RDefineBase;
+class RJittedFilter;
+class RJittedDefine;
 using ROOT::RDF::RDataSource;
 
 /// The head node of a RDF computation graph.
@@ -188,6 +191,19 @@ class RLoopManager : public RNodeBase {
    std::set<std::pair<std::string_view, std::unique_ptr<ROOT::Internal::RDF::RVariationsWithReaders>>>
       fUniqueVariationsWithReaders;
 
+   /// Whether equivalent jitted Filters and Defines should share the same node of the computation graph.
+   bool fShareJittedNodes{false};
+   /// Jitted Filters that can be shared, indexed by the key that identifies the computation they perform.
+   std::unordered_map<std::string, std::weak_ptr<RJittedFilter>> fShareableJittedFilters;
+   /// Jitted Defines that can be shared, indexed by the key that identifies the computation they perform.
+   std::unordered_map<std::string, std::weak_ptr<RJittedDefine>> fShareableJittedDefines;
+   unsigned int fNSharedFilters{0}; ///< Number of Filter calls that reused an existing equivalent node
+   unsigned int fNSharedDefines{0}; ///< Number of Define calls that reused an existing equivalent node
+
+   /// Timing information about the last event loop. Null if profiling is not enabled.
+   std::unique_ptr<RDFInternal::RLoopProfiler> fProfiler;
+   void SetupProfiler();
+
 public:
    RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches);
    RLoopManager(std::unique_ptr<TTree> tree, const ColumnNames_t &defaultBranches);
@@ -262,6 +278,18 @@ public:
    void SetEmptyEntryRange(std::pair<ULong64_t, ULong64_t> &&newRange);
    void ChangeSpec(ROOT::RDF::Experimental::RDatasetSpec &&spec);
 
+   void SetShareJittedNodes(bool share) { fShareJittedNodes = share; }
+   bool GetShareJittedNodes() const { return fShareJittedNodes; }
+   std::shared_ptr<RJittedFilter> GetSharedJittedFilter(const std::string &key);
+   void AddShareableJittedFilter(const std::string &key, const std::shared_ptr<RJittedFilter> &filter);
+   std::shared_ptr<RJittedDefine> GetSharedJittedDefine(const std::string &key);
+   void AddShareableJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define);
+   unsigned int GetNSharedFilters() const { return fNSharedFilters; }
+   unsigned int GetNSharedDefines() const { return fNSharedDefines; }
+
+   void SetProfiling(bool enable);
+   const RDFInternal::RLoopProfiler *GetProfiler() const { return fProfiler.get(); }
+
    ROOT::Internal::RDF::RStringCache &GetColumnNamesCache() { return fCachedColNames; }
    std::set<std::pair<std::string_view, std::unique_ptr<ROOT::Internal::RDF::RDefinesWithReaders>>> &
    GetUniqueDefinesWithReaders()
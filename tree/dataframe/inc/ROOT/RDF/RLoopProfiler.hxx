@@ -0,0 +1,146 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RLOOPPROFILER
+#define ROOT_RDF_RLOOPPROFILER
+
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RLoopProfiler
+\ingroup dataframe
+\brief Collect timing information about the nodes and the tasks of an RDataFrame event loop.
+
+Filters, Defines and actions are registered at the beginning of each event loop and measure the time spent in their
+own evaluation through RNodeTimer. Times are exclusive: the evaluation of a Define that is triggered lazily by a Filter
+or an action is accounted to the Define, not to the node that requested its value. Since the input columns are read
+lazily as well, the time spent reading a column is accounted to the first node that needs its value for a given entry.
+
+Each processing slot has its own counters, so no synchronization is needed during the event loop.
+See ROOT::RDF::Experimental::EnableProfiling.
+*/
+class RLoopProfiler {
+public:
+   using Clock_t = std::chrono::steady_clock;
+
+private:
+   struct RNodeInfo {
+      std::string fKind;
+      std::string fName;
+      std::string fVariation;
+   };
+
+   struct RNodeCounters {
+      Clock_t::duration fTime{0};
+      ULong64_t fNCalls = 0;
+   };
+
+   struct RTaskInfo {
+      Clock_t::time_point fStart;
+      Clock_t::time_point fEnd;
+      ULong64_t fNEntries = 0;
+   };
+
+   /// Everything a slot writes during the event loop, aligned to avoid false sharing between slots.
+   struct alignas(64) RSlotData {
+      std::vector<RNodeCounters> fNodes;
+      std::vector<RTaskInfo> fTasks;
+      /// Time spent in nodes nested in the one currently being evaluated (see RNodeTimer).
+      Clock_t::duration fChildTime{0};
+   };
+
+   std::vector<RNodeInfo> fNodes;
+   std::vector<RSlotData> fSlots;
+   Clock_t::time_point fLoopStart;
+   Clock_t::time_point fLoopEnd;
+   Long64_t fBytesRead = 0;
+   unsigned int fLoopId = 0;
+
+public:
+   RLoopProfiler(unsigned int nSlots) : fSlots(nSlots) {}
+
+   /// Forget the nodes and the counters of the previous event loop.
+   void Reset();
+   /// Register a node of the computation graph, return the identifier it must use with RNodeTimer.
+   unsigned int RegisterNode(const std::string &kind, const std::string &name, const std::string &variation);
+
+   void StartLoop(unsigned int loopId);
+   void StopLoop(Long64_t bytesRead);
+   void StartTask(unsigned int slot) { fSlots[slot].fTasks.push_back({Clock_t::now(), {}, 0ull}); }
+   void StopTask(unsigned int slot)
+   {
+      if (!fSlots[slot].fTasks.empty())
+         fSlots[slot].fTasks.back().fEnd = Clock_t::now();
+   }
+   void CountEntry(unsigned int slot) { ++fSlots[slot].fTasks.back().fNEntries; }
+
+   /// Start the measurement of a node evaluation. The returned value must be passed to the matching StopNode call.
+   Clock_t::duration StartNode(unsigned int slot)
+   {
+      auto &slotData = fSlots[slot];
+      const auto outerChildTime = slotData.fChildTime;
+      slotData.fChildTime = Clock_t::duration{0};
+      return outerChildTime;
+   }
+
+   void StopNode(unsigned int slot, unsigned int nodeId, Clock_t::duration elapsed, Clock_t::duration outerChildTime)
+   {
+      auto &slotData = fSlots[slot];
+      auto &counters = slotData.fNodes[nodeId];
+      counters.fTime += elapsed - slotData.fChildTime;
+      ++counters.fNCalls;
+      // the parent node, if any, must not account for the time spent here
+      slotData.fChildTime = outerChildTime + elapsed;
+   }
+
+   /// Return a report of the last event loop in JSON format.
+   std::string GetReport() const;
+   /// Return the timeline of the tasks of the last event loop in the Chrome trace event format.
+   std::string GetTrace() const;
+};
+
+/// RAII object that measures the time spent by a node between its construction and its destruction.
+/// It does nothing if the profiler is null, i.e. if profiling is not enabled.
+class RNodeTimer {
+   RLoopProfiler *fProfiler;
+   unsigned int fSlot;
+   unsigned int fNodeId;
+   RLoopProfiler::Clock_t::duration fOuterChildTime{0};
+   RLoopProfiler::Clock_t::time_point fStart;
+
+public:
+   RNodeTimer(RLoopProfiler *profiler, unsigned int slot, unsigned int nodeId)
+      : fProfiler(profiler), fSlot(slot), fNodeId(nodeId)
+   {
+      if (fProfiler) {
+         fOuterChildTime = fProfiler->StartNode(fSlot);
+         fStart = RLoopProfiler::Clock_t::now();
+      }
+   }
+   RNodeTimer(const RNodeTimer &) = delete;
+   RNodeTimer &operator=(const RNodeTimer &) = delete;
+   ~RNodeTimer()
+   {
+      if (fProfiler)
+         fProfiler->StopNode(fSlot, fNodeId, RLoopProfiler::Clock_t::now() - fStart, fOuterChildTime);
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RLOOPPROFILER
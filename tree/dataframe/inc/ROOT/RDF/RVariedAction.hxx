@@ -151,8 +151,10 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
-         if (fPrevNodes[varIdx]->CheckFilters(slot, entry))
+         if (fPrevNodes[varIdx]->CheckFilters(slot, entry)) {
+            RNodeTimer timer(fProfiler, slot, fProfilerId);
             CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
+         }
       }
    }
 
@@ -179,6 +181,8 @@ public:
    /// Return the partially-updated value connected to the first variation.
    void *PartialUpdate(unsigned int slot) final { return PartialUpdateImpl(slot); }
 
+   std::string GetActionName() final { return "Varied " + fHelpers[0].GetActionName(); }
+
    /// Return a callback that in turn runs the callbacks of each variation's helper.
    ROOT::RDF::SampleCallback_t GetSampleCallback() final
    {
@@ -26,6 +26,8 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -297,6 +299,72 @@ void AddProgressBar(ROOT::RDF::RNode df);
 /// For more details see ROOT::RDF::Experimental::ProgressHelper Class.
 void AddProgressBar(ROOT::RDataFrame df);
 
+/// \brief Share the nodes of equivalent jitted Filters and Defines in a computation graph.
+/// \param[in] df Any node of the computation graph.
+/// \param[in] enable Whether sharing should be enabled.
+///
+/// Analysis code often books the same string Filter or Define in several branches of the computation graph, e.g.
+/// because the branches are built by the same helper function. By default, each copy is a separate node of the
+/// computation graph that is evaluated independently during the event loop. When node sharing is enabled, the
+/// Filters and Defines booked afterwards reuse an existing equivalent node instead, so that the common computation
+/// is performed only once per entry. Two nodes are equivalent if they evaluate the same expression on the same input
+/// columns (i.e. the inputs that are defined columns come from the same Define nodes) and:
+/// - for Filters: they are unnamed (named filters are part of the cut-flow report) and follow the same node;
+/// - for Defines: they define a column with the same name.
+///
+/// Nodes whose inputs are affected by systematic variations are never shared. Expressions are assumed to have no
+/// side effects: for example, two Filters that call a random number generator would be merged into a single one.
+/// The number of shared nodes is reported by Describe().
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::EnableNodeSharing(df);
+/// auto h1 = df.Filter("x > 0").Define("y", "x * x").Histo1D("y");
+/// auto h2 = df.Filter("x > 0").Define("y", "x * x").Mean("y"); // same Filter and Define nodes as h1
+/// ~~~
+void EnableNodeSharing(ROOT::RDF::RNode df, bool enable = true);
+
+/// \brief Collect timing information during the event loops of a computation graph.
+/// \param[in] df Any node of the computation graph.
+/// \param[in] enable Whether profiling should be enabled.
+///
+/// When profiling is enabled, every Filter, Define and action of the computation graph measures the time spent in its
+/// own evaluation, and each processing slot records when it starts and finishes its tasks. Times are exclusive: the
+/// evaluation of a Define triggered by a Filter is accounted to the Define. Input columns are read lazily, so the time
+/// spent reading a column is accounted to the first node that needs it for a given entry. The results of the last
+/// event loop can be retrieved with GetProfilingReport and SaveProfilingTrace.
+///
+/// Measuring times has a cost: profiling should be disabled in production.
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::EnableProfiling(df);
+/// auto h = df.Filter("x > 0").Define("y", "x * x").Histo1D("y");
+/// h->Draw(); // runs the event loop
+/// std::cout << ROOT::RDF::Experimental::GetProfilingReport(df);
+/// ROOT::RDF::Experimental::SaveProfilingTrace(df, "trace.json"); // open with chrome://tracing or ui.perfetto.dev
+/// ~~~
+void EnableProfiling(ROOT::RDF::RNode df, bool enable = true);
+
+/// \brief Return the timing information about the last event loop of a computation graph, in JSON format.
+/// \param[in] df Any node of the computation graph.
+///
+/// The report contains the wall-clock time of the event loop, the number of entries processed and the number of
+/// bytes read from ROOT files during the event loop (by any thread of the application), then:
+/// - `nodes`: for each Filter, Define and action, the number of evaluations and the total time spent in them;
+/// - `slots`: for each processing slot, the number of tasks and entries processed, the time spent processing them
+///   (`busyTime`) and the time spent waiting for work during the event loop (`idleTime`).
+///
+/// Times are in seconds. Profiling must have been enabled with EnableProfiling, otherwise an exception is thrown.
+std::string GetProfilingReport(ROOT::RDF::RNode df);
+
+/// \brief Save the timeline of the tasks of the last event loop of a computation graph, in Chrome trace format.
+/// \param[in] df Any node of the computation graph.
+/// \param[in] fileName Name of the output file.
+///
+/// Each processing slot is displayed as a separate thread, with one event per task, i.e. per range of entries
+/// processed. The file can be opened with chrome://tracing or https://ui.perfetto.dev.
+/// Profiling must have been enabled with EnableProfiling, otherwise an exception is thrown.
+void SaveProfilingTrace(ROOT::RDF::RNode df, std::string_view fileName);
+
 class ProgressBarAction;
 
 /// RDF progress helper.
@@ -68,9 +68,12 @@ double-quote characters must be represented by a pair of double-quote characters
     2000,Mercury,Cougar
 ~~~
 
-The current implementation of RCsvDS reads the entire CSV file content into memory before
-RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
-important to check both how much memory is available and the size of the CSV file.
+By default, RCsvDS reads the entire CSV file content into memory before RDataFrame starts
+processing it. Therefore, before creating a CSV RDataFrame, it is important to check both how
+much memory is available and the size of the CSV file. For large files, the chunk size parameter
+bounds the memory usage: the file is then read and processed in chunks of that many lines.
+Records are stored column-wise in their native types, and when implicit multi-threading is
+enabled the lines of each chunk are parsed in parallel.
 
 RCsvDS can handle empty cells and also allows the usage of the special keywords "NaN" and "nan" to
 indicate `nan` values. If the column is of type double, these cells are stored internally as `nan`.
@@ -78,12 +81,20 @@ Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored
 */
 // clang-format on
 
+#include "RConfigure.h" // R__USE_IMT
 #include <ROOT/TSeq.hxx>
 #include <ROOT/RCsvDS.hxx>
 #include <ROOT/RRawFile.hxx>
 #include <TError.h>
+#include <TROOT.h> // IsImplicitMTEnabled
+
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -117,42 +128,112 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
+void RCsvDS::FillRecords(const std::vector<std::string> &lines)
 {
-   auto i = 0U;
+   const auto nColumns = fHeaders.size();
+   const auto nRecords = lines.size();
+
+   fDoubleRecords.resize(nColumns);
+   fLong64Records.resize(nColumns);
+   fStringRecords.resize(nColumns);
+   fBoolRecords.resize(nColumns);
+   auto colIndex = 0U;
+   for (auto colType : fColTypesList) {
+      switch (colType) {
+      case 'D': fDoubleRecords[colIndex].resize(nRecords); break;
+      case 'L': fLong64Records[colIndex].resize(nRecords); break;
+      case 'O': fBoolRecords[colIndex].resize(nRecords); break;
+      case 'T': fStringRecords[colIndex].resize(nRecords); break;
+      }
+      ++colIndex;
+   }
 
-   auto columns = ParseColumns(line);
+   // Each task parses a contiguous range of lines into its own slice of the column storage,
+   // and keeps track of the columns for which it encountered empty cells
+   auto fillRange = [&](std::size_t begin, std::size_t end, std::vector<char> &colContainingEmpty) {
+      std::vector<std::string_view> columns;
+      std::vector<std::string> unquotedColumns;
+      colContainingEmpty.resize(nColumns, 0);
+      for (auto i = begin; i < end; ++i)
+         FillRecord(lines[i], i, columns, unquotedColumns, colContainingEmpty);
+   };
+
+   // minimum number of lines parsed by a single task, to amortize the scheduling cost
+   constexpr std::size_t minLinesPerTask = 10000;
+   std::vector<std::vector<char>> colContainingEmpty;
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nRecords >= 2 * minLinesPerTask) {
+      ROOT::TThreadExecutor pool;
+      const std::size_t nTasks = std::min<std::size_t>(nRecords / minLinesPerTask, 4 * pool.GetPoolSize());
+      const auto linesPerTask = nRecords / nTasks;
+      colContainingEmpty.resize(nTasks);
+      pool.Foreach(
+         [&](unsigned int task) {
+            const auto begin = task * linesPerTask;
+            const auto end = task == nTasks - 1 ? nRecords : begin + linesPerTask;
+            fillRange(begin, end, colContainingEmpty[task]);
+         },
+         ROOT::TSeqU(nTasks));
+   } else
+#endif
+   {
+      colContainingEmpty.resize(1);
+      fillRange(0, nRecords, colContainingEmpty[0]);
+   }
 
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
+   for (const auto &taskColContainingEmpty : colContainingEmpty) {
+      for (auto i = 0U; i < nColumns; ++i) {
+         if (taskColContainingEmpty[i])
+            fColContainingEmpty.insert(fHeaders[i]);
+      }
+   }
+}
+
+void RCsvDS::FillRecord(const std::string &line, std::size_t recordIndex, std::vector<std::string_view> &columns,
+                        std::vector<std::string> &unquotedColumns, std::vector<char> &colContainingEmpty)
+{
+   SplitColumns(line, columns, unquotedColumns);
+
+   if (columns.size() != fHeaders.size()) {
+      std::string msg = "RCsvDS: found a record with " + std::to_string(columns.size()) + " fields, expected " +
+                        std::to_string(fHeaders.size()) + ":\n" + line;
+      throw std::runtime_error(msg);
+   }
+
+   auto i = 0U;
+   for (auto colType : fColTypesList) {
+      const auto col = columns[i];
+      const bool isNaN = col == "nan";
 
       switch (colType) {
       case 'D': {
-         record.emplace_back(new double((col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN()));
+         fDoubleRecords[i][recordIndex] = isNaN ? std::numeric_limits<double>::quiet_NaN() : std::stod(std::string(col));
          break;
       }
       case 'L': {
-         if (col != "nan") {
-            record.emplace_back(new Long64_t(std::stoll(col)));
+         if (!isNaN) {
+            fLong64Records[i][recordIndex] = std::stoll(std::string(col));
          } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            record.emplace_back(new Long64_t(0));
+            colContainingEmpty[i] = 1;
+            fLong64Records[i][recordIndex] = 0;
          }
          break;
       }
       case 'O': {
-         auto b = new bool();
-         record.emplace_back(b);
-         if (col != "nan") {
-            std::istringstream(col) >> std::boolalpha >> *b;
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            *b = false;
+         bool b = false;
+         if (col == "true") {
+            b = true;
+         } else if (isNaN) {
+            colContainingEmpty[i] = 1;
+         } else if (col != "false") {
+            std::istringstream(std::string(col)) >> std::boolalpha >> b;
          }
+         fBoolRecords[i][recordIndex] = b;
          break;
       }
       case 'T': {
-         record.emplace_back(new std::string(col));
+         fStringRecords[i][recordIndex].assign(col.data(), col.size());
          break;
       }
       }
@@ -183,19 +264,10 @@ std::vector<void *> RCsvDS::GetColumnReadersImpl(std::string_view colName, const
 
    const auto &colNames = GetColumnNames();
    const auto index = std::distance(colNames.begin(), std::find(colNames.begin(), colNames.end(), colName));
+   // the addresses are set to the values of the current record in SetEntry
    std::vector<void *> ret(fNSlots);
    for (auto slot : ROOT::TSeqU(fNSlots)) {
-      auto &val = fColAddresses[index][slot];
-      if (ti == typeid(double)) {
-         val = &fDoubleEvtValues[index][slot];
-      } else if (ti == typeid(Long64_t)) {
-         val = &fLong64EvtValues[index][slot];
-      } else if (ti == typeid(std::string)) {
-         val = &fStringEvtValues[index][slot];
-      } else {
-         val = &fBoolEvtValues[index][slot];
-      }
-      ret[slot] = &val;
+      ret[slot] = &fColAddresses[index][slot];
    }
    return ret;
 }
@@ -318,6 +390,36 @@ size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &col
    return i;
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Split a line into its fields, with the same semantics as ParseColumns().
+/// Lines without quotes, by far the most common case, are split in place with memchr (which is vectorized
+/// by the common C libraries) and no string is allocated: the fields are views on the line.
+/// Lines that contain quotes go through ParseColumns(), and `unquotedColumns` owns the unescaped fields.
+void RCsvDS::SplitColumns(const std::string &line, std::vector<std::string_view> &columns,
+                          std::vector<std::string> &unquotedColumns)
+{
+   columns.clear();
+
+   if (line.find('"') != std::string::npos) {
+      unquotedColumns = ParseColumns(line);
+      for (const auto &col : unquotedColumns)
+         columns.emplace_back(col);
+      return;
+   }
+
+   const char *cur = line.data();
+   const char *const end = cur + line.size();
+   while (true) {
+      const char *next = static_cast<const char *>(std::memchr(cur, fDelimiter, end - cur));
+      const std::string_view col(cur, (next ? next : end) - cur);
+      // empty cell or explicit nan/NaN
+      columns.emplace_back((col.empty() || col == "NaN") ? std::string_view("nan") : col);
+      if (!next)
+         break;
+      cur = next + 1;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Constructor to create a CSV RDataSource for RDataFrame.
 /// \param[in] fileName Path or URL of the CSV file.
@@ -376,45 +478,21 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
 
 void RCsvDS::FreeRecords()
 {
-   for (auto &record : fRecords) {
-      for (size_t i = 0; i < record.size(); ++i) {
-         void *p = record[i];
-         const auto colType = fColTypes[fHeaders[i]];
-         switch (colType) {
-         case 'D': {
-            delete static_cast<double *>(p);
-            break;
-         }
-         case 'L': {
-            delete static_cast<Long64_t *>(p);
-            break;
-         }
-         case 'O': {
-            delete static_cast<bool *>(p);
-            break;
-         }
-         case 'T': {
-            delete static_cast<std::string *>(p);
-            break;
-         }
-         }
-      }
-   }
-   fRecords.clear();
+   fDoubleRecords.clear();
+   fLong64Records.clear();
+   fStringRecords.clear();
+   fBoolRecords.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
-RCsvDS::~RCsvDS()
-{
-   FreeRecords();
-}
+RCsvDS::~RCsvDS() = default;
 
 void RCsvDS::Finalize()
 {
    fCsvFile->Seek(fDataPos);
    fProcessedLines = 0ULL;
-   fEntryRangesRequested = 0ULL;
+   fChunkFirstEntry = 0ULL;
    FreeRecords();
 }
 
@@ -425,18 +503,23 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
-   // Read records and store them in memory
+   // Read the lines of the next chunk, then parse them and store the records in memory
    auto linesToRead = fLinesChunkSize;
-   FreeRecords();
+   std::vector<std::string> lines;
+   if (fLinesChunkSize > 0)
+      lines.reserve(fLinesChunkSize);
 
    std::string line;
    while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
       if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
+      lines.emplace_back(std::move(line));
       --linesToRead;
    }
 
+   FillRecords(lines);
+   const auto nRecords = lines.size();
+   lines = std::vector<std::string>(); // release the raw lines before processing the chunk
+
    if (!fColContainingEmpty.empty()) {
       std::string msg = "";
       for (const auto &col : fColContainingEmpty) {
@@ -451,14 +534,13 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
-         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fRecords.size());
+         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", nRecords);
       } else {
-         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fRecords.size());
+         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, nRecords);
       }
    }
 
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   const auto nRecords = fRecords.size();
    if (0 == nRecords)
       return entryRanges;
 
@@ -475,8 +557,8 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
    }
    entryRanges.back().second += remainder;
 
+   fChunkFirstEntry = fProcessedLines;
    fProcessedLines += nRecords;
-   fEntryRangesRequested++;
 
    return entryRanges;
 }
@@ -505,26 +587,27 @@ bool RCsvDS::HasColumn(std::string_view colName) const
 bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
    // Here we need to normalise the entry to the number of lines we already processed.
-   const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
-   const auto recordPos = entry - offset;
+   const auto recordPos = entry - fChunkFirstEntry;
+   // The column readers point to the addresses stored in fColAddresses: we just point them to the record values,
+   // no copy is needed.
    int colIndex = 0;
    for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
+      auto &dataPtr = fColAddresses[colIndex][slot];
       switch (colType) {
       case 'D': {
-         fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
+         dataPtr = &fDoubleRecords[colIndex][recordPos];
          break;
       }
       case 'L': {
-         fLong64EvtValues[colIndex][slot] = *static_cast<Long64_t *>(dataPtr);
+         dataPtr = &fLong64Records[colIndex][recordPos];
          break;
       }
       case 'O': {
-         fBoolEvtValues[colIndex][slot] = *static_cast<bool *>(dataPtr);
+         dataPtr = &fBoolRecords[colIndex][recordPos];
          break;
       }
       case 'T': {
-         fStringEvtValues[colIndex][slot] = *static_cast<std::string *>(dataPtr);
+         dataPtr = &fStringRecords[colIndex][recordPos];
          break;
       }
       }
@@ -542,12 +625,6 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    const auto nColumns = fHeaders.size();
    // Initialize the entire set of addresses
    fColAddresses.resize(nColumns, std::vector<void *>(fNSlots, nullptr));
-
-   // Initialize the per event data holders
-   fDoubleEvtValues.resize(nColumns, std::vector<double>(fNSlots));
-   fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
-   fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
-   fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
 }
 
 std::string RCsvDS::GetLabel()
@@ -22,8 +22,10 @@
 #endif // R__USE_IMT
 
 #include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <set>
+#include <stdexcept>
 #include <cstdio>
 
 // TODO, this function should be part of core libraries
@@ -384,6 +386,40 @@ void AddProgressBar(ROOT::RDataFrame dataframe)
    auto node = ROOT::RDF::AsRNode(dataframe);
    ROOT::RDF::Experimental::AddProgressBar(node);
 }
+
+void EnableNodeSharing(ROOT::RDF::RNode df, bool enable)
+{
+   ROOT::Internal::RDF::SetShareJittedNodes(df, enable);
+}
+
+void EnableProfiling(ROOT::RDF::RNode df, bool enable)
+{
+   ROOT::Internal::RDF::SetProfiling(df, enable);
+}
+
+namespace {
+const ROOT::Internal::RDF::RLoopProfiler &GetProfilerOrThrow(const ROOT::RDF::RNode &df, const std::string &caller)
+{
+   const auto *profiler = ROOT::Internal::RDF::GetLoopProfiler(df);
+   if (!profiler)
+      throw std::runtime_error(caller + ": profiling is not enabled for this computation graph, see EnableProfiling.");
+   return *profiler;
+}
+} // anonymous namespace
+
+std::string GetProfilingReport(ROOT::RDF::RNode df)
+{
+   return GetProfilerOrThrow(df, "GetProfilingReport").GetReport();
+}
+
+void SaveProfilingTrace(ROOT::RDF::RNode df, std::string_view fileName)
+{
+   const auto trace = GetProfilerOrThrow(df, "SaveProfilingTrace").GetTrace();
+   std::ofstream out{std::string(fileName)};
+   if (!out)
+      throw std::runtime_error("SaveProfilingTrace: could not open file \"" + std::string(fileName) + "\".");
+   out << trace;
+}
 } // namespace Experimental
 } // namespace RDF
 } // namespace ROOT
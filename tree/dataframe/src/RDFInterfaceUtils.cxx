@@ -154,6 +154,84 @@ FindUsedColsAndAliases(const std::string &expr, const ColumnNames_t &treeBranchN
    return {{usedCols.begin(), usedCols.end()}, {usedAliases.begin(), usedAliases.end()}};
 }
 
+/// Rewrite accesses to data members of the elements of a collection, such as `Jet[i].pt`, as accesses to the
+/// corresponding elements of the sub-column that only contains those data members, i.e. `Jet.pt[i]`.
+/// This way only the sub-branches (or sub-fields) that are actually needed are read and deserialized instead of full
+/// objects, as it already happens when the sub-column is used directly. The rewrite only happens if:
+/// - `Jet` and `Jet.pt` are both columns of the dataset (`Jet` is not a Define or an Alias)
+/// - neither column is affected by systematic variations
+/// - `pt` is the last element of the access, i.e. it is not a method call and it is not followed by `.` or `[`
+std::string PruneCollectionMemberAccess(const std::string &expr, const ColumnNames_t &treeBranchNames,
+                                        const ROOT::Internal::RDF::RColumnRegister &colRegister,
+                                        const ColumnNames_t &dataSourceColNames)
+{
+   // quick check to avoid tokenizing expressions that cannot contain such accesses
+   if (expr.find("].") == std::string::npos)
+      return expr;
+
+   lexertk::generator tokens;
+   if (!tokens.process(expr))
+      return expr; // FindUsedColsAndAliases will complain
+
+   auto isDatasetColumn = [&](const std::string &col) {
+      return !colRegister.IsDefineOrAlias(col) &&
+             (IsStrInVec(col, treeBranchNames) || IsStrInVec(col, dataSourceColNames)) &&
+             colRegister.GetVariationsFor(col).empty();
+   };
+
+   const auto kSymbol = lexertk::token::e_symbol;
+   const auto nTokens = tokens.size();
+   std::string out;
+   std::size_t copiedUpTo = 0; // position in expr up to which the input has been copied to the output
+   for (auto i = 0u; i < nTokens; ++i) {
+      // look for the start of a (dot chain of) symbol(s)
+      if (tokens[i].type != kSymbol || (i > 0 && tokens[i - 1].value == "."))
+         continue;
+      std::string collection = tokens[i].value;
+      auto last = i;
+      while (last + 2 < nTokens && tokens[last + 1].value == "." && tokens[last + 2].type == kSymbol) {
+         collection += "." + tokens[last + 2].value;
+         last += 2;
+      }
+
+      if (last + 1 >= nTokens || tokens[last + 1].type != lexertk::token::e_lsqrbracket)
+         continue;
+
+      // find the matching closing square bracket
+      auto closing = last + 1;
+      for (int depth = 0; closing < nTokens; ++closing) {
+         if (tokens[closing].type == lexertk::token::e_lsqrbracket)
+            ++depth;
+         else if (tokens[closing].type == lexertk::token::e_rsqrbracket && --depth == 0)
+            break;
+      }
+
+      const auto member = closing + 2;
+      if (member >= nTokens || tokens[closing + 1].value != "." || tokens[member].type != kSymbol)
+         continue;
+      if (member + 1 < nTokens && (tokens[member + 1].type == lexertk::token::e_lbracket ||
+                                   tokens[member + 1].type == lexertk::token::e_lsqrbracket ||
+                                   tokens[member + 1].value == "."))
+         continue;
+
+      const auto subColumn = collection + "." + tokens[member].value;
+      if (!isDatasetColumn(collection) || !isDatasetColumn(subColumn))
+         continue;
+
+      // `collection[index].member` -> `collection.member[index]`
+      const auto indexBegin = tokens[last + 1].position;
+      const auto indexEnd = tokens[closing].position + 1;
+      out += expr.substr(copiedUpTo, indexBegin - copiedUpTo);
+      out += "." + tokens[member].value;
+      out += expr.substr(indexBegin, indexEnd - indexBegin);
+      copiedUpTo = tokens[member].position + tokens[member].value.size();
+      i = member;
+   }
+   out += expr.substr(copiedUpTo);
+
+   return out;
+}
+
 /// Substitute each '.' in a string with '\.'
 std::string EscapeDots(const std::string &s)
 {
@@ -188,6 +266,9 @@ ParsedExpression ParseRDFExpression(std::string_view expr, const ColumnNames_t &
       "(^|\\W)#(?!(ifdef|ifndef|if|else|elif|endif|pragma|define|undef|include|line))([a-zA-Z_][a-zA-Z0-9_]*)");
    colSizeReplacer.Substitute(preProcessedExpr, "$1R_rdf_sizeof_$3", "g");
 
+   preProcessedExpr = PruneCollectionMemberAccess(std::string(preProcessedExpr), treeBranchNames, colRegister,
+                                                  dataSourceColNames);
+
    ColumnNames_t usedCols;
    ColumnNames_t usedAliases;
    std::tie(usedCols, usedAliases) =
@@ -361,6 +442,23 @@ ThrowJitBuildActionHelperTypeError(const std::string &actionTypeNameBase, const
    throw std::runtime_error(exceptionText);
 }
 
+/// Build the key that identifies the computation performed by a jitted Filter or Define: nodes with the same key
+/// produce the same values for every entry, so they can be shared. `nodeId` identifies what, besides the jitted
+/// function and its inputs, makes the node unique (the previous node for Filters, the column name for Defines).
+/// The inputs are identified by name and by the address of their Define node, if any.
+/// Return an empty key if the node must not be shared, i.e. if its inputs are affected by systematic variations.
+std::string MakeJittedNodeKey(const std::string &nodeId, const std::string &funcName, const ColumnNames_t &usedCols,
+                              const ROOT::Internal::RDF::RColumnRegister &colRegister)
+{
+   if (!colRegister.GetVariationDeps(usedCols).empty())
+      return "";
+
+   std::string key = nodeId + "|" + funcName;
+   for (const auto &col : usedCols)
+      key += "|" + col + "@" + ROOT::Internal::RDF::PrettyPrintAddr(colRegister.GetDefine(col));
+   return key;
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -652,6 +750,22 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
+   // Unnamed filters are not part of the cut-flow report, so an equivalent one that hangs from the same node of the
+   // computation graph can be reused as is
+   auto *lm = (*prevNodeOnHeap)->GetLoopManagerUnchecked();
+   std::string sharingKey;
+   if (lm->GetShareJittedNodes() && name.empty()) {
+      sharingKey =
+         MakeJittedNodeKey(PrettyPrintAddr(prevNodeOnHeap->get()), funcName, parsedExpr.fUsedCols, colRegister);
+      if (!sharingKey.empty()) {
+         if (auto sharedFilter = lm->GetSharedJittedFilter(sharingKey)) {
+            // no jitted call will take care of prevNodeOnHeap
+            delete prevNodeOnHeap;
+            return sharedFilter;
+         }
+      }
+   }
+
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RColumnRegister *definesOnHeap = new ROOT::Internal::RDF::RColumnRegister(colRegister);
    const auto definesOnHeapAddr = PrettyPrintAddr(definesOnHeap);
@@ -681,8 +795,9 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
                     << "reinterpret_cast<ROOT::Internal::RDF::RColumnRegister*>(" << definesOnHeapAddr << ")"
                     << ");\n";
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
    lm->ToJitExec(filterInvocation.str());
+   if (!sharingKey.empty())
+      lm->AddShareableJittedFilter(sharingKey, jittedFilter);
 
    return jittedFilter;
 }
@@ -702,6 +817,20 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    const auto funcName = DeclareFunction(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
    const auto type = RetTypeOfFunc(funcName);
 
+   // Defines are evaluated lazily, when a downstream node reads them, so an equivalent Define with the same name can
+   // be reused even if it was booked in another branch of the computation graph
+   std::string sharingKey;
+   if (lm.GetShareJittedNodes()) {
+      sharingKey = MakeJittedNodeKey(std::string(name), funcName, parsedExpr.fUsedCols, colRegister);
+      if (!sharingKey.empty()) {
+         if (auto sharedDefine = lm.GetSharedJittedDefine(sharingKey)) {
+            // no jitted call will take care of upcastNodeOnHeap
+            delete upcastNodeOnHeap;
+            return sharedDefine;
+         }
+      }
+   }
+
    auto definesCopy = new RColumnRegister(colRegister);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm, colRegister, parsedExpr.fUsedCols);
@@ -727,6 +856,8 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
                     << PrettyPrintAddr(upcastNodeOnHeap) << "));\n";
 
    lm.ToJitExec(defineInvocation.str());
+   if (!sharingKey.empty())
+      lm.AddShareableJittedDefine(sharingKey, jittedDefine);
    return jittedDefine;
 }
 
@@ -28,6 +28,38 @@ void ROOT::Internal::RDF::ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Ex
    node.GetLoopManager()->ChangeSpec(std::move(spec));
 }
 
+/**
+ * \brief Set whether equivalent jitted Filters and Defines share the same node of the computation graph.
+ *
+ * \param node Any node of the computation graph.
+ * \param share Whether nodes should be shared.
+ */
+void ROOT::Internal::RDF::SetShareJittedNodes(const ROOT::RDF::RNode &node, bool share)
+{
+   node.GetLoopManager()->SetShareJittedNodes(share);
+}
+
+/**
+ * \brief Enable or disable the collection of timing information in the event loops of a computation graph.
+ *
+ * \param node Any node of the computation graph.
+ * \param enable Whether timing information should be collected.
+ */
+void ROOT::Internal::RDF::SetProfiling(const ROOT::RDF::RNode &node, bool enable)
+{
+   node.GetLoopManager()->SetProfiling(enable);
+}
+
+/**
+ * \brief Return the profiler of a computation graph, or nullptr if profiling is not enabled.
+ *
+ * \param node Any node of the computation graph.
+ */
+const ROOT::Internal::RDF::RLoopProfiler *ROOT::Internal::RDF::GetLoopProfiler(const ROOT::RDF::RNode &node)
+{
+   return node.GetLoopManager()->GetProfiler();
+}
+
 /**
  * \brief Trigger the execution of an RDataFrame computation graph.
  * \param[in] node A node of the computation graph (not a result).
@@ -243,11 +243,17 @@ ROOT::RDF::RDFDescription ROOT::RDF::RInterfaceBase::Describe()
       definedColumnNamesSet.insert(name);
 
    // Get information for the metadata table
-   const std::vector<std::string> metadataProperties = {"Columns in total", "Columns from defines", "Event loops run",
-                                                        "Processing slots"};
-   const std::vector<std::string> metadataValues = {std::to_string(columnNames.size()),
-                                                    std::to_string(definedColumnNamesSet.size()),
-                                                    std::to_string(GetNRuns()), std::to_string(GetNSlots())};
+   std::vector<std::string> metadataProperties = {"Columns in total", "Columns from defines", "Event loops run",
+                                                  "Processing slots"};
+   std::vector<std::string> metadataValues = {std::to_string(columnNames.size()),
+                                              std::to_string(definedColumnNamesSet.size()),
+                                              std::to_string(GetNRuns()), std::to_string(GetNSlots())};
+   // Report what node sharing did, if enabled (see ROOT::RDF::Experimental::EnableNodeSharing)
+   if (fLoopManager->GetShareJittedNodes()) {
+      metadataProperties.insert(metadataProperties.end(), {"Shared Filter nodes", "Shared Define nodes"});
+      metadataValues.insert(metadataValues.end(), {std::to_string(fLoopManager->GetNSharedFilters()),
+                                                   std::to_string(fLoopManager->GetNSharedDefines())});
+   }
 
    // Set header for metadata table
    const auto columnWidthProperties = RDFInternal::GetColumnWidth(metadataProperties);
@@ -109,6 +109,12 @@ void *RJittedAction::PartialUpdate(unsigned int slot)
    return fConcreteAction->PartialUpdate(slot);
 }
 
+std::string RJittedAction::GetActionName()
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
 bool RJittedAction::HasRun() const
 {
    if (fConcreteAction != nullptr) {
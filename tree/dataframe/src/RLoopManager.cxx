@@ -14,6 +14,8 @@
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RDefineReader.hxx" // RDefinesWithReaders
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RJittedDefine.hxx"
+#include "ROOT/RDF/RJittedFilter.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RVariationBase.hxx"
@@ -679,6 +681,9 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       fNewSampleNotifier.UnsetFlag(slot);
    }
 
+   if (fProfiler)
+      fProfiler->CountEntry(slot);
+
    for (auto *actionPtr : fBookedActions)
       actionPtr->Run(slot, entry);
    for (auto *namedFilterPtr : fBookedNamedFilters)
@@ -692,6 +697,8 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 /// calls their `InitSlot` method, to get them ready for running a task.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
+   if (fProfiler)
+      fProfiler->StartTask(slot);
    SetupSampleCallbacks(r, slot);
    for (auto *ptr : fBookedActions)
       ptr->InitSlot(r, slot);
@@ -749,6 +756,7 @@ void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
 void RLoopManager::InitNodes()
 {
    EvalChildrenCounts();
+   SetupProfiler();
    for (auto *filter : fBookedFilters)
       filter->InitNode();
    for (auto *range : fBookedRanges)
@@ -799,6 +807,50 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
       for (auto &v : fDatasetColumnReaders[slot])
          v.second.reset();
    }
+
+   if (fProfiler)
+      fProfiler->StopTask(slot);
+}
+
+/// Register the nodes of the computation graph with the profiler, if profiling is enabled, and let them know where
+/// to report their timings. To be called before each event loop: the set of booked actions changes at every run.
+void RLoopManager::SetupProfiler()
+{
+   auto *profiler = fProfiler.get();
+   if (profiler)
+      profiler->Reset();
+
+   for (auto *ptr : fBookedFilters) {
+      // jitted filters only forward the calls to their concrete filter, which is also booked
+      if (profiler && !dynamic_cast<RJittedFilter *>(ptr)) {
+         const auto name = ptr->HasName() ? ptr->GetName() : "Unnamed Filter";
+         ptr->SetProfiler(profiler, profiler->RegisterNode("Filter", name, ptr->GetVariation()));
+      } else {
+         ptr->SetProfiler(nullptr, 0u);
+      }
+   }
+   for (auto *ptr : fBookedDefines) {
+      if (profiler)
+         ptr->SetProfiler(profiler, profiler->RegisterNode("Define", ptr->GetName(), ptr->GetVariation()));
+      else
+         ptr->SetProfiler(nullptr, 0u);
+   }
+   for (auto *ptr : fBookedActions) {
+      if (profiler)
+         ptr->SetProfiler(profiler, profiler->RegisterNode("Action", ptr->GetActionName(), ""));
+      else
+         ptr->SetProfiler(nullptr, 0u);
+   }
+}
+
+/// Enable or disable the collection of timing information during the next event loops.
+/// See ROOT::RDF::Experimental::EnableProfiling.
+void RLoopManager::SetProfiling(bool enable)
+{
+   if (!enable)
+      fProfiler.reset();
+   else if (!fProfiler)
+      fProfiler = std::make_unique<RDFInternal::RLoopProfiler>(fNSlots);
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
@@ -874,6 +926,10 @@ void RLoopManager::Run(bool jit)
    TStopwatch s;
    s.Start();
 
+   const auto bytesReadBefore = TFile::GetFileBytesRead();
+   if (fProfiler)
+      fProfiler->StartLoop(fNRuns);
+
    switch (fLoopType) {
    case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
    case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
@@ -884,6 +940,9 @@ void RLoopManager::Run(bool jit)
    }
    s.Stop();
 
+   if (fProfiler)
+      fProfiler->StopLoop(TFile::GetFileBytesRead() - bytesReadBefore);
+
    fNRuns++;
 
    R__LOG_INFO(RDFLogChannel()) << "Finished event loop number " << fNRuns - 1 << " (" << s.CpuTime() << "s CPU, "
@@ -1118,6 +1177,49 @@ void RLoopManager::SetEmptyEntryRange(std::pair<ULong64_t, ULong64_t> &&newRange
    fEmptyEntryRange = std::move(newRange);
 }
 
+/// \brief Return the jitted Filter registered with the given key, if it is still alive, or nullptr otherwise.
+/// Every successful lookup counts as one shared Filter node.
+std::shared_ptr<RJittedFilter> RLoopManager::GetSharedJittedFilter(const std::string &key)
+{
+   auto it = fShareableJittedFilters.find(key);
+   if (it == fShareableJittedFilters.end())
+      return nullptr;
+   auto filter = it->second.lock();
+   if (!filter) {
+      // the branch of the computation graph that used this filter went out of scope
+      fShareableJittedFilters.erase(it);
+      return nullptr;
+   }
+   ++fNSharedFilters;
+   return filter;
+}
+
+void RLoopManager::AddShareableJittedFilter(const std::string &key, const std::shared_ptr<RJittedFilter> &filter)
+{
+   fShareableJittedFilters[key] = filter;
+}
+
+/// \brief Return the jitted Define registered with the given key, if it is still alive, or nullptr otherwise.
+/// Every successful lookup counts as one shared Define node.
+std::shared_ptr<RJittedDefine> RLoopManager::GetSharedJittedDefine(const std::string &key)
+{
+   auto it = fShareableJittedDefines.find(key);
+   if (it == fShareableJittedDefines.end())
+      return nullptr;
+   auto define = it->second.lock();
+   if (!define) {
+      fShareableJittedDefines.erase(it);
+      return nullptr;
+   }
+   ++fNSharedDefines;
+   return define;
+}
+
+void RLoopManager::AddShareableJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define)
+{
+   fShareableJittedDefines[key] = define;
+}
+
 /**
  * \brief Helper function to open a file (or the first file from a glob).
  * This function is used at construction time of an RDataFrame, to check the
@@ -0,0 +1,167 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RLoopProfiler.hxx"
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+namespace {
+std::string JSONEscape(const std::string &s)
+{
+   std::string out;
+   out.reserve(s.size());
+   for (const char c : s) {
+      switch (c) {
+      case '"': out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\t': out += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned int>(c));
+            out += buf;
+         } else {
+            out += c;
+         }
+      }
+   }
+   return out;
+}
+
+template <typename Duration>
+double ToSeconds(Duration d)
+{
+   return std::chrono::duration<double>(d).count();
+}
+
+template <typename Duration>
+double ToMicroseconds(Duration d)
+{
+   return std::chrono::duration<double, std::micro>(d).count();
+}
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+void RLoopProfiler::Reset()
+{
+   fNodes.clear();
+   for (auto &slotData : fSlots) {
+      slotData.fNodes.clear();
+      slotData.fTasks.clear();
+      slotData.fChildTime = Clock_t::duration{0};
+   }
+   fBytesRead = 0;
+}
+
+unsigned int
+RLoopProfiler::RegisterNode(const std::string &kind, const std::string &name, const std::string &variation)
+{
+   fNodes.push_back({kind, name, variation});
+   return fNodes.size() - 1;
+}
+
+void RLoopProfiler::StartLoop(unsigned int loopId)
+{
+   fLoopId = loopId;
+   for (auto &slotData : fSlots)
+      slotData.fNodes.resize(fNodes.size());
+   fLoopStart = Clock_t::now();
+}
+
+void RLoopProfiler::StopLoop(Long64_t bytesRead)
+{
+   fLoopEnd = Clock_t::now();
+   fBytesRead = bytesRead;
+}
+
+std::string RLoopProfiler::GetReport() const
+{
+   const auto wallTime = fLoopEnd - fLoopStart;
+
+   std::ostringstream os;
+   os.precision(9);
+   os << "{\n";
+   os << "  \"eventLoop\": " << fLoopId << ",\n";
+   os << "  \"wallTime\": " << ToSeconds(wallTime) << ",\n";
+   os << "  \"bytesRead\": " << fBytesRead << ",\n";
+
+   ULong64_t nEntries = 0ull;
+   for (const auto &slotData : fSlots)
+      for (const auto &task : slotData.fTasks)
+         nEntries += task.fNEntries;
+   os << "  \"entries\": " << nEntries << ",\n";
+
+   os << "  \"nodes\": [";
+   for (auto nodeId = 0u; nodeId < fNodes.size(); ++nodeId) {
+      Clock_t::duration time{0};
+      ULong64_t nCalls = 0ull;
+      for (const auto &slotData : fSlots) {
+         if (nodeId < slotData.fNodes.size()) {
+            time += slotData.fNodes[nodeId].fTime;
+            nCalls += slotData.fNodes[nodeId].fNCalls;
+         }
+      }
+      const auto &node = fNodes[nodeId];
+      os << (nodeId == 0 ? "\n" : ",\n");
+      os << "    {\"kind\": \"" << node.fKind << "\", \"name\": \"" << JSONEscape(node.fName) << '"';
+      if (!node.fVariation.empty())
+         os << ", \"variation\": \"" << JSONEscape(node.fVariation) << '"';
+      os << ", \"calls\": " << nCalls << ", \"time\": " << ToSeconds(time) << "}";
+   }
+   os << (fNodes.empty() ? "],\n" : "\n  ],\n");
+
+   os << "  \"slots\": [";
+   for (auto slot = 0u; slot < fSlots.size(); ++slot) {
+      const auto &tasks = fSlots[slot].fTasks;
+      Clock_t::duration busyTime{0};
+      ULong64_t slotEntries = 0ull;
+      for (const auto &task : tasks) {
+         busyTime += task.fEnd - task.fStart;
+         slotEntries += task.fNEntries;
+      }
+      const auto idleTime = std::max(wallTime - busyTime, Clock_t::duration{0});
+      os << (slot == 0 ? "\n" : ",\n");
+      os << "    {\"slot\": " << slot << ", \"tasks\": " << tasks.size() << ", \"entries\": " << slotEntries
+         << ", \"busyTime\": " << ToSeconds(busyTime) << ", \"idleTime\": " << ToSeconds(idleTime) << "}";
+   }
+   os << (fSlots.empty() ? "]\n" : "\n  ]\n");
+   os << "}\n";
+   return os.str();
+}
+
+std::string RLoopProfiler::GetTrace() const
+{
+   std::ostringstream os;
+   os.precision(3);
+   os << std::fixed;
+   os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+   os << "  {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": 0, \"args\": {\"name\": "
+      << "\"RDataFrame event loop " << fLoopId << "\"}}";
+   for (auto slot = 0u; slot < fSlots.size(); ++slot) {
+      os << ",\n  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << slot
+         << ", \"args\": {\"name\": \"slot " << slot << "\"}}";
+      for (const auto &task : fSlots[slot].fTasks) {
+         os << ",\n  {\"name\": \"task\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << slot
+            << ", \"ts\": " << ToMicroseconds(task.fStart - fLoopStart)
+            << ", \"dur\": " << ToMicroseconds(task.fEnd - task.fStart) << ", \"args\": {\"entries\": " << task.fNEntries
+            << "}}";
+      }
+   }
+   os << "\n]}\n";
+   return os.str();
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
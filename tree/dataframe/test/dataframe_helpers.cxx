@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <fstream>
 #include <vector>
 #include <string>
 
@@ -753,6 +754,76 @@ TEST(RDFHelpers, Cleanup_After_Exception)
       << "The Finalize method should have changed the value of testVal during the post-exception cleanup." << std::endl;
 }
 
+TEST(RDFHelpers, EnableNodeSharing)
+{
+   gInterpreter->Declare("int RDFHelpersNodeSharingCounter = 0;"
+                         "bool RDFHelpersNodeSharingPass(ULong64_t e) { ++RDFHelpersNodeSharingCounter; return e % 2; }");
+
+   ROOT::RDataFrame df(10);
+   ROOT::RDF::Experimental::EnableNodeSharing(df);
+   auto makeBranch = [](ROOT::RDF::RNode n) {
+      return n.Filter("RDFHelpersNodeSharingPass(rdfentry_)").Define("x", "rdfentry_ * 2");
+   };
+   auto b1 = makeBranch(df);
+   auto b2 = makeBranch(df);
+   // named filters, defines with a different name or on different inputs are never shared
+   auto b3 = df.Filter("RDFHelpersNodeSharingPass(rdfentry_)", "named").Define("x", "rdfentry_ * 2");
+   auto b4 = b1.Define("y", "rdfentry_ * 2").Define("z", "x + 1");
+   auto b5 = b2.Define("z", "x + 1");
+
+   auto s1 = b1.Sum<ULong64_t>("x");
+   auto s2 = b2.Sum<ULong64_t>("x");
+   auto s3 = b3.Sum<ULong64_t>("x");
+   auto s4 = b4.Sum<ULong64_t>("z");
+   auto s5 = b5.Sum<ULong64_t>("z");
+   EXPECT_EQ(*s1, 50ull);
+   EXPECT_EQ(*s2, 50ull);
+   EXPECT_EQ(*s3, 50ull);
+   EXPECT_EQ(*s4, 55ull);
+   EXPECT_EQ(*s5, 55ull);
+   // the unnamed filter is evaluated once per entry, the named one once more
+   EXPECT_EQ(gInterpreter->Calc("RDFHelpersNodeSharingCounter"), 20);
+
+   const auto description = df.Describe().AsString();
+   EXPECT_NE(description.find("Shared Filter nodes         1"), std::string::npos) << description;
+   EXPECT_NE(description.find("Shared Define nodes         3"), std::string::npos) << description;
+}
+
+TEST(RDFHelpers, Profiling)
+{
+   ROOT::RDataFrame df(10);
+   EXPECT_THROW(ROOT::RDF::Experimental::GetProfilingReport(df), std::runtime_error);
+
+   ROOT::RDF::Experimental::EnableProfiling(df);
+   auto c = df.Define("x", [](ULong64_t e) { return e; }, {"rdfentry_"})
+               .Filter([](ULong64_t x) { return x > 4; }, {"x"}, "xcut")
+               .Count();
+   EXPECT_EQ(*c, 5ull);
+
+   const auto report = ROOT::RDF::Experimental::GetProfilingReport(df);
+   EXPECT_NE(report.find("\"entries\": 10,"), std::string::npos) << report;
+   EXPECT_NE(report.find("{\"kind\": \"Filter\", \"name\": \"xcut\", \"variation\": \"nominal\", \"calls\": 10,"),
+             std::string::npos)
+      << report;
+   // the Define is evaluated lazily by the Filter, once per entry
+   EXPECT_NE(report.find("{\"kind\": \"Define\", \"name\": \"x\", \"variation\": \"nominal\", \"calls\": 10,"),
+             std::string::npos)
+      << report;
+   EXPECT_NE(report.find("{\"kind\": \"Action\", \"name\": \"Count\", \"calls\": 5,"), std::string::npos) << report;
+   EXPECT_NE(report.find("{\"slot\": 0, \"tasks\": 1, \"entries\": 10,"), std::string::npos) << report;
+
+   const auto traceFile = "RDFHelpers_Profiling.json";
+   ROOT::RDF::Experimental::SaveProfilingTrace(df, traceFile);
+   std::ifstream trace(traceFile);
+   const std::string traceContent{std::istreambuf_iterator<char>(trace), std::istreambuf_iterator<char>()};
+   EXPECT_NE(traceContent.find("\"traceEvents\""), std::string::npos) << traceContent;
+   EXPECT_NE(traceContent.find("\"args\": {\"entries\": 10}"), std::string::npos) << traceContent;
+   gSystem->Unlink(traceFile);
+
+   ROOT::RDF::Experimental::EnableProfiling(df, false);
+   EXPECT_THROW(ROOT::RDF::Experimental::SaveProfilingTrace(df, traceFile), std::runtime_error);
+}
+
 // The code below is a unit test for a function called `ProgressHelper_Existence_MT` in the `RDFHelpers` class.
 
 #ifdef R__USE_IMT
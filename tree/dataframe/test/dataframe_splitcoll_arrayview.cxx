@@ -62,11 +62,38 @@ void test_splitcoll_arrayview(const std::string &fileName, const std::string &tr
    EXPECT_EQ(*c2, 7ull);
 }
 
+// Accesses such as `v[i].a` in jitted expressions are rewritten as `v.a[i]`, which only reads the `v.a` sub-branch
+void test_splitcoll_memberaccess(const std::string &fileName, const std::string &treeName)
+{
+   ROOT::TestSupport::CheckDiagsRAII diagRAII;
+   diagRAII.optionalDiag(
+      kWarning, "RTreeColumnReader::Get",
+      "Branch v.a hangs from a non-split branch. A copy is being performed in order to properly read the content.");
+   diagRAII.optionalDiag(
+      kWarning, "RTreeColumnReader::Get",
+      "Branch v.b hangs from a non-split branch. A copy is being performed in order to properly read the content.");
+
+   ROOT::RDataFrame df(treeName, fileName);
+   auto sumFirst = df.Define("x", "v[0].a + v[v.size() - 1].b").Sum<float>("x");
+   auto nPass = df.Filter("v[v.a.size() - 1].a > 4").Count();
+   // v is redefined: the sub-branches of the original column must not be used
+   auto sumRedefined =
+      df.Redefine("v", [](const ROOT::RVec<TwoFloats> &v) { return ROOT::RVec<TwoFloats>(v.size(), TwoFloats(1.f)); })
+         .Define("x", "v[0].a")
+         .Sum<float>("x");
+
+   // entry i contains i + 1 elements, with a = 0, ..., i and b = 2 * a
+   EXPECT_FLOAT_EQ(*sumFirst, 90.f);
+   EXPECT_EQ(*nPass, 5ull);
+   EXPECT_FLOAT_EQ(*sumRedefined, 10.f);
+}
+
 TEST(RDFSimpleTests, SplitCollectionArrayView)
 {
    auto fileName = "myfile_test_splitcoll_arrayview.root";
    auto treeName = "myTree";
    fill_tree(fileName, treeName);
    test_splitcoll_arrayview(fileName, treeName);
+   test_splitcoll_memberaccess(fileName, treeName);
    gSystem->Unlink(fileName);
 }
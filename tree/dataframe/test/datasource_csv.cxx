@@ -3,9 +3,12 @@
 #include <ROOT/TSeq.hxx>
 #include <ROOT/TestSupport.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
 using namespace ROOT::RDF;
 
 auto fileName0 = "RCsvDS_test_headers.csv";
@@ -326,6 +329,33 @@ TEST(RCsvDS, ProgressiveReadingRDFMT)
    EXPECT_EQ(6U, *c2);
 }
 
+TEST(RCsvDS, ParallelParsingMT)
+{
+   // enough lines for the parsing of each chunk to be split in several tasks
+   const auto fname = "RCsvDS_test_parallelparsing.csv";
+   const auto nLines = 100000LL;
+   {
+      std::ofstream f(fname);
+      f << "x,y,name,flag\n";
+      for (auto i = 0LL; i < nLines; ++i)
+         f << i << ',' << i * 0.5 << ",\"n," << i << "\"," << (i % 2 ? "true" : "false") << '\n';
+   }
+
+   for (auto chunkSize : {-1LL, 30000LL}) {
+      auto df = ROOT::RDF::FromCSV(fname, true, ',', chunkSize);
+      auto sumX = df.Sum<Long64_t>("x");
+      auto sumY = df.Sum<double>("y");
+      auto nFlags = df.Filter([](bool b) { return b; }, {"flag"}).Count();
+      auto nNames = df.Filter([](const std::string &n) { return n.substr(0, 2) == "n,"; }, {"name"}).Count();
+      EXPECT_EQ(*sumX, nLines * (nLines - 1) / 2);
+      EXPECT_DOUBLE_EQ(*sumY, 0.5 * nLines * (nLines - 1) / 2);
+      EXPECT_EQ(*nFlags, ULong64_t(nLines / 2));
+      EXPECT_EQ(*nNames, ULong64_t(nLines));
+   }
+
+   gSystem->Unlink(fname);
+}
+
 TEST(RCsvDS, SpecifyColumnTypes)
 {
    RCsvDS tds0(fileName0, true, ',', -1LL, {{"Age", 'D'}, {"Name", 'T'}}); // with headers